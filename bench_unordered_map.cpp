@@ -0,0 +1,56 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "unordered_map.hpp"
+
+// Times insert, find and erase on ft::unordered_map against
+// std::unordered_map with 2M random 64-bit keys. Half of the finds miss.
+
+typedef std::chrono::steady_clock bench_clock;
+
+static double elapsed_ms(bench_clock::time_point from, bench_clock::time_point to)
+{
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+template <class Map>
+void bench(const char *name, const std::vector<unsigned long> &keys, bool reserve)
+{
+    bench_clock::time_point t0 = bench_clock::now();
+    Map m;
+    if (reserve)
+        m.reserve(keys.size());
+    for (std::size_t i = 0; i < keys.size(); i++)
+        m[keys[i]] = i;
+    bench_clock::time_point t1 = bench_clock::now();
+    unsigned long sum = 0;
+    for (int round = 0; round < 3; round++)
+        for (std::size_t i = 0; i < keys.size(); i++)
+        {
+            typename Map::const_iterator it = m.find(keys[i] + (i & 1));
+            if (it != m.end())
+                sum += it->second;
+        }
+    bench_clock::time_point t2 = bench_clock::now();
+    for (std::size_t i = 0; i < keys.size(); i += 2)
+        m.erase(keys[i]);
+    bench_clock::time_point t3 = bench_clock::now();
+    std::printf("%-14s insert %8.1f  find %8.1f  erase %8.1f ms  (checksum %lu)\n", name,
+                elapsed_ms(t0, t1), elapsed_ms(t1, t2), elapsed_ms(t2, t3), sum);
+}
+
+int main()
+{
+    std::mt19937_64 rng(42);
+    std::vector<unsigned long> keys(2000000);
+    // Even keys only, so key + 1 is always a miss.
+    for (std::size_t i = 0; i < keys.size(); i++)
+        keys[i] = rng() << 1;
+    bench<std::unordered_map<unsigned long, std::size_t> >("std", keys, false);
+    bench<ft::unordered_map<unsigned long, std::size_t> >("ft", keys, false);
+    bench<std::unordered_map<unsigned long, std::size_t> >("std reserve", keys, true);
+    bench<ft::unordered_map<unsigned long, std::size_t> >("ft reserve", keys, true);
+    return 0;
+}
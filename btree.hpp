@@ -0,0 +1,984 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "pool_allocator.hpp"
+#include "rb_tree.hpp"
+
+namespace ft
+{
+
+    // How many entries fit in NodeBytes of payload: leaves hold values,
+    // internal nodes hold separator keys plus one child pointer per key.
+    template <class Key, class Value, std::size_t NodeBytes>
+    struct btree_node_capacity
+    {
+        static const std::size_t leaf = NodeBytes / sizeof(Value) < 4 ? 4 : NodeBytes / sizeof(Value);
+        static const std::size_t internal =
+            NodeBytes / (sizeof(Key) + sizeof(void *)) < 4 ? 4 : NodeBytes / (sizeof(Key) + sizeof(void *));
+    };
+
+    // Arithmetic keys under std::less are ranked with a branch-free count the
+    // compiler can vectorize; every other key is binary searched.
+    template <class Key, class Compare>
+    struct btree_linear_search
+        : std::integral_constant<bool, std::is_arithmetic<Key>::value &&
+                                           std::is_same<Compare, std::less<Key>>::value>
+    {
+    };
+
+    // A B+tree with unique keys, the engine behind ft::btree_map and
+    // ft::btree_set. Values live only in leaves, packed in arrays and linked
+    // into a list, so scans walk contiguous memory; internal nodes hold
+    // packed separator keys, so a lookup touches one node per level. Any
+    // insert or erase invalidates iterators.
+    template <class Key, class Value, class KeyOfValue, class Compare,
+              class Alloc = std::allocator<Value>, std::size_t NodeBytes = 256>
+    class btree
+    {
+    public:
+        typedef Key key_type;
+        typedef Value value_type;
+        typedef Compare key_compare;
+        typedef Alloc allocator_type;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef value_type &reference;
+        typedef const value_type &const_reference;
+        typedef value_type *pointer;
+        typedef const value_type *const_pointer;
+
+        static const size_type LEAF_CAPACITY = btree_node_capacity<Key, Value, NodeBytes>::leaf;
+        static const size_type INTERNAL_CAPACITY = btree_node_capacity<Key, Value, NodeBytes>::internal;
+
+    private:
+        struct internal_node;
+
+        struct node_base
+        {
+            internal_node *parent;
+            size_type position;
+            size_type count;
+            bool leaf;
+        };
+
+        struct leaf_node : node_base
+        {
+            leaf_node *prev;
+            leaf_node *next;
+            typename std::aligned_storage<sizeof(Value) * LEAF_CAPACITY,
+                                          std::alignment_of<Value>::value>::type storage;
+
+            pointer values() { return reinterpret_cast<pointer>(&storage); }
+        };
+
+        // children[i] holds keys in [keys[i - 1], keys[i]).
+        struct internal_node : node_base
+        {
+            node_base *children[INTERNAL_CAPACITY + 1];
+            typename std::aligned_storage<sizeof(Key) * INTERNAL_CAPACITY,
+                                          std::alignment_of<Key>::value>::type storage;
+
+            key_type *keys() { return reinterpret_cast<key_type *>(&storage); }
+        };
+
+    public:
+        class iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef Value value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef Value *pointer;
+            typedef Value &reference;
+
+            iterator() : _leaf(nullptr), _pos(0) {}
+            iterator(leaf_node *leaf, size_type pos) : _leaf(leaf), _pos(pos) {}
+
+            reference operator*() const { return _leaf->values()[_pos]; }
+            pointer operator->() const { return _leaf->values() + _pos; }
+
+            iterator &operator++()
+            {
+                if (++_pos == _leaf->count && _leaf->next)
+                {
+                    _leaf = _leaf->next;
+                    _pos = 0;
+                }
+                return *this;
+            }
+            iterator operator++(int)
+            {
+                iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+            iterator &operator--()
+            {
+                if (_pos == 0)
+                {
+                    _leaf = _leaf->prev;
+                    _pos = _leaf->count;
+                }
+                --_pos;
+                return *this;
+            }
+            iterator operator--(int)
+            {
+                iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const iterator &other) const { return _leaf == other._leaf && _pos == other._pos; }
+            bool operator!=(const iterator &other) const { return !(*this == other); }
+
+            leaf_node *leaf() const { return _leaf; }
+            size_type pos() const { return _pos; }
+
+        private:
+            leaf_node *_leaf;
+            size_type _pos;
+        };
+
+        class const_iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef Value value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const Value *pointer;
+            typedef const Value &reference;
+
+            const_iterator() : _leaf(nullptr), _pos(0) {}
+            const_iterator(leaf_node *leaf, size_type pos) : _leaf(leaf), _pos(pos) {}
+            const_iterator(const iterator &other) : _leaf(other.leaf()), _pos(other.pos()) {}
+
+            reference operator*() const { return _leaf->values()[_pos]; }
+            pointer operator->() const { return _leaf->values() + _pos; }
+
+            const_iterator &operator++()
+            {
+                if (++_pos == _leaf->count && _leaf->next)
+                {
+                    _leaf = _leaf->next;
+                    _pos = 0;
+                }
+                return *this;
+            }
+            const_iterator operator++(int)
+            {
+                const_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+            const_iterator &operator--()
+            {
+                if (_pos == 0)
+                {
+                    _leaf = _leaf->prev;
+                    _pos = _leaf->count;
+                }
+                --_pos;
+                return *this;
+            }
+            const_iterator operator--(int)
+            {
+                const_iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const const_iterator &other) const { return _leaf == other._leaf && _pos == other._pos; }
+            bool operator!=(const const_iterator &other) const { return !(*this == other); }
+
+            leaf_node *leaf() const { return _leaf; }
+            size_type pos() const { return _pos; }
+
+        private:
+            leaf_node *_leaf;
+            size_type _pos;
+        };
+
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    private:
+        typedef typename Alloc::template rebind<leaf_node>::other leaf_allocator;
+        typedef typename Alloc::template rebind<internal_node>::other internal_allocator;
+
+        node_base *_root;
+        leaf_node *_first;
+        leaf_node *_last;
+        size_type _size;
+        key_compare _comp;
+        allocator_type _alloc;
+        leaf_allocator leaf_alloc;
+        internal_allocator internal_alloc;
+
+        static const key_type &_key(const value_type &v) { return KeyOfValue()(v); }
+
+        // Moves n objects from src to dst, ending each source's lifetime.
+        // Walks backwards when dst is above src so overlapping shifts work.
+        template <class T>
+        static void _relocate(T *dst, T *src, size_type n)
+        {
+            if (dst > src)
+                for (size_type i = n; i-- > 0;)
+                {
+                    ::new (static_cast<void *>(dst + i)) T(std::move(src[i]));
+                    src[i].~T();
+                }
+            else
+                for (size_type i = 0; i < n; ++i)
+                {
+                    ::new (static_cast<void *>(dst + i)) T(std::move(src[i]));
+                    src[i].~T();
+                }
+        }
+
+        template <class T>
+        static void _destroy_range(T *first, size_type n)
+        {
+            for (size_type i = 0; i < n; ++i)
+                first[i].~T();
+        }
+
+        // Count of entries whose key is below k, and not above k.
+        template <class T, class Proj>
+        size_type _lower_rank(const T *first, size_type n, const key_type &k, Proj proj) const
+        {
+            if (btree_linear_search<Key, Compare>::value)
+            {
+                size_type rank = 0;
+                for (size_type i = 0; i < n; ++i)
+                    rank += _comp(proj(first[i]), k);
+                return rank;
+            }
+            const T *lo = first;
+            while (n > 0)
+            {
+                size_type half = n / 2;
+                if (_comp(proj(lo[half]), k))
+                {
+                    lo += half + 1;
+                    n -= half + 1;
+                }
+                else
+                    n = half;
+            }
+            return lo - first;
+        }
+
+        template <class T, class Proj>
+        size_type _upper_rank(const T *first, size_type n, const key_type &k, Proj proj) const
+        {
+            if (btree_linear_search<Key, Compare>::value)
+            {
+                size_type rank = 0;
+                for (size_type i = 0; i < n; ++i)
+                    rank += !_comp(k, proj(first[i]));
+                return rank;
+            }
+            const T *lo = first;
+            while (n > 0)
+            {
+                size_type half = n / 2;
+                if (!_comp(k, proj(lo[half])))
+                {
+                    lo += half + 1;
+                    n -= half + 1;
+                }
+                else
+                    n = half;
+            }
+            return lo - first;
+        }
+
+        leaf_node *_new_leaf()
+        {
+            leaf_node *leaf = leaf_alloc.allocate(1);
+            leaf->parent = nullptr;
+            leaf->position = 0;
+            leaf->count = 0;
+            leaf->leaf = true;
+            leaf->prev = leaf->next = nullptr;
+            return leaf;
+        }
+
+        internal_node *_new_internal()
+        {
+            internal_node *node = internal_alloc.allocate(1);
+            node->parent = nullptr;
+            node->position = 0;
+            node->count = 0;
+            node->leaf = false;
+            return node;
+        }
+
+        void _free_node(node_base *x)
+        {
+            if (x->leaf)
+                leaf_alloc.deallocate(static_cast<leaf_node *>(x), 1);
+            else
+                internal_alloc.deallocate(static_cast<internal_node *>(x), 1);
+        }
+
+        // Destroys everything under x; nodes go back to their allocators
+        // only when free_nodes is set.
+        void _destroy_subtree(node_base *x, bool free_nodes)
+        {
+            if (x->leaf)
+                _destroy_range(static_cast<leaf_node *>(x)->values(), x->count);
+            else
+            {
+                internal_node *node = static_cast<internal_node *>(x);
+                for (size_type i = 0; i <= node->count; ++i)
+                    _destroy_subtree(node->children[i], free_nodes);
+                _destroy_range(node->keys(), node->count);
+            }
+            if (free_nodes)
+                _free_node(x);
+        }
+
+        void _init_empty()
+        {
+            _root = nullptr;
+            _first = _last = nullptr;
+            _size = 0;
+        }
+
+        bool _is_rightmost(const node_base *x) const
+        {
+            for (; x->parent; x = x->parent)
+                if (x->position != x->parent->count)
+                    return false;
+            return true;
+        }
+
+        leaf_node *_find_leaf(const key_type &k) const
+        {
+            node_base *x = _root;
+            while (!x->leaf)
+            {
+                internal_node *node = static_cast<internal_node *>(x);
+                x = node->children[_upper_rank(node->keys(), node->count, k, rb_identity())];
+            }
+            return static_cast<leaf_node *>(x);
+        }
+
+        // Inserts key and its right-hand child after child position at.
+        void _internal_insert(internal_node *node, size_type at, const key_type &key, node_base *child)
+        {
+            key_type *keys = node->keys();
+            _relocate(keys + at + 1, keys + at, node->count - at);
+            try
+            {
+                ::new (static_cast<void *>(keys + at)) key_type(key);
+            }
+            catch (...)
+            {
+                _relocate(keys + at, keys + at + 1, node->count - at);
+                throw;
+            }
+            for (size_type i = node->count + 1; i > at + 1; --i)
+            {
+                node->children[i] = node->children[i - 1];
+                node->children[i]->position = i;
+            }
+            node->children[at + 1] = child;
+            child->parent = node;
+            child->position = at + 1;
+            ++node->count;
+        }
+
+        // Removes keys[at] and the child to its right.
+        void _internal_erase(internal_node *node, size_type at)
+        {
+            key_type *keys = node->keys();
+            keys[at].~key_type();
+            _relocate(keys + at, keys + at + 1, node->count - at - 1);
+            for (size_type i = at + 1; i < node->count; ++i)
+            {
+                node->children[i] = node->children[i + 1];
+                node->children[i]->position = i;
+            }
+            --node->count;
+        }
+
+        void _insert_into_parent(node_base *left, const key_type &sep, node_base *right)
+        {
+            internal_node *parent = left->parent;
+            if (!parent)
+            {
+                internal_node *root = _new_internal();
+                ::new (static_cast<void *>(root->keys())) key_type(sep);
+                root->count = 1;
+                root->children[0] = left;
+                root->children[1] = right;
+                left->parent = right->parent = root;
+                left->position = 0;
+                right->position = 1;
+                _root = root;
+                return;
+            }
+            size_type at = left->position;
+            if (parent->count == INTERNAL_CAPACITY)
+            {
+                size_type mid = at == parent->count && _is_rightmost(parent)
+                                    ? parent->count - 1
+                                    : parent->count / 2;
+                internal_node *sibling = _split_internal(parent, mid);
+                if (at > mid)
+                {
+                    parent = sibling;
+                    at -= mid + 1;
+                }
+            }
+            _internal_insert(parent, at, sep, right);
+        }
+
+        // Moves keys after mid and their children into a new right sibling
+        // and pushes keys[mid] up to the parent.
+        internal_node *_split_internal(internal_node *node, size_type mid)
+        {
+            internal_node *right = _new_internal();
+            size_type moved = node->count - mid - 1;
+            _relocate(right->keys(), node->keys() + mid + 1, moved);
+            for (size_type i = 0; i <= moved; ++i)
+            {
+                right->children[i] = node->children[mid + 1 + i];
+                right->children[i]->parent = right;
+                right->children[i]->position = i;
+            }
+            right->count = moved;
+            key_type up(std::move(node->keys()[mid]));
+            node->keys()[mid].~key_type();
+            node->count = mid;
+            _insert_into_parent(node, up, right);
+            return right;
+        }
+
+        leaf_node *_split_leaf(leaf_node *leaf, size_type at)
+        {
+            leaf_node *right = _new_leaf();
+            _relocate(right->values(), leaf->values() + at, leaf->count - at);
+            right->count = leaf->count - at;
+            leaf->count = at;
+            right->prev = leaf;
+            right->next = leaf->next;
+            if (leaf->next)
+                leaf->next->prev = right;
+            else
+                _last = right;
+            leaf->next = right;
+            _insert_into_parent(leaf, _key(right->values()[0]), right);
+            return right;
+        }
+
+        template <class V>
+        iterator _insert_at(leaf_node *leaf, size_type pos, V &&v)
+        {
+            if (leaf->count == LEAF_CAPACITY)
+            {
+                // Appending past the last leaf leaves the old one full, so
+                // sorted input packs leaves instead of half-filling them.
+                size_type at = !leaf->next && pos == leaf->count ? leaf->count - 1 : leaf->count / 2;
+                leaf_node *right = _split_leaf(leaf, at);
+                if (pos > at)
+                {
+                    leaf = right;
+                    pos -= at;
+                }
+            }
+            pointer values = leaf->values();
+            _relocate(values + pos + 1, values + pos, leaf->count - pos);
+            try
+            {
+                ::new (static_cast<void *>(values + pos)) value_type(std::forward<V>(v));
+            }
+            catch (...)
+            {
+                _relocate(values + pos, values + pos + 1, leaf->count - pos);
+                throw;
+            }
+            ++leaf->count;
+            ++_size;
+            return iterator(leaf, pos);
+        }
+
+        // Appends b, the right neighbour of a under the same parent, to a.
+        void _merge_leaves(leaf_node *a, leaf_node *b)
+        {
+            _relocate(a->values() + a->count, b->values(), b->count);
+            a->count += b->count;
+            a->next = b->next;
+            if (b->next)
+                b->next->prev = a;
+            else
+                _last = a;
+            internal_node *parent = b->parent;
+            _internal_erase(parent, b->position - 1);
+            _free_node(b);
+            _rebalance_internal(parent);
+        }
+
+        // Refills a leaf that fell below half, either by merging it with a
+        // sibling or by taking entries from one. (tl, tp) tracks the entry
+        // that followed the erased one.
+        void _rebalance_leaf(leaf_node *leaf, leaf_node *&tl, size_type &tp)
+        {
+            internal_node *parent = leaf->parent;
+            size_type i = leaf->position;
+            leaf_node *left = i > 0 ? static_cast<leaf_node *>(parent->children[i - 1]) : nullptr;
+            leaf_node *right = i < parent->count ? static_cast<leaf_node *>(parent->children[i + 1]) : nullptr;
+            if (left && left->count + leaf->count <= LEAF_CAPACITY)
+            {
+                tl = left;
+                tp += left->count;
+                _merge_leaves(left, leaf);
+            }
+            else if (right && leaf->count + right->count <= LEAF_CAPACITY)
+                _merge_leaves(leaf, right);
+            else if (left)
+            {
+                size_type n = (left->count - leaf->count) / 2;
+                _relocate(leaf->values() + n, leaf->values(), leaf->count);
+                _relocate(leaf->values(), left->values() + left->count - n, n);
+                left->count -= n;
+                leaf->count += n;
+                parent->keys()[i - 1] = _key(leaf->values()[0]);
+                tp += n;
+            }
+            else
+            {
+                size_type n = (right->count - leaf->count) / 2;
+                _relocate(leaf->values() + leaf->count, right->values(), n);
+                _relocate(right->values(), right->values() + n, right->count - n);
+                right->count -= n;
+                leaf->count += n;
+                parent->keys()[i] = _key(right->values()[0]);
+            }
+        }
+
+        // Appends b, the right neighbour of a, to a along with the
+        // separator between them.
+        void _merge_internal(internal_node *a, internal_node *b)
+        {
+            internal_node *parent = a->parent;
+            size_type k = a->position;
+            ::new (static_cast<void *>(a->keys() + a->count)) key_type(std::move(parent->keys()[k]));
+            _relocate(a->keys() + a->count + 1, b->keys(), b->count);
+            for (size_type j = 0; j <= b->count; ++j)
+            {
+                node_base *child = b->children[j];
+                a->children[a->count + 1 + j] = child;
+                child->parent = a;
+                child->position = a->count + 1 + j;
+            }
+            a->count += b->count + 1;
+            _internal_erase(parent, k);
+            _free_node(b);
+            _rebalance_internal(parent);
+        }
+
+        void _rebalance_internal(internal_node *node)
+        {
+            if (node == _root)
+            {
+                if (node->count == 0)
+                {
+                    _root = node->children[0];
+                    _root->parent = nullptr;
+                    _root->position = 0;
+                    _free_node(node);
+                }
+                return;
+            }
+            if (node->count >= INTERNAL_CAPACITY / 2)
+                return;
+            internal_node *parent = node->parent;
+            size_type i = node->position;
+            internal_node *left = i > 0 ? static_cast<internal_node *>(parent->children[i - 1]) : nullptr;
+            internal_node *right = i < parent->count ? static_cast<internal_node *>(parent->children[i + 1]) : nullptr;
+            if (left && left->count + node->count + 1 <= INTERNAL_CAPACITY)
+                _merge_internal(left, node);
+            else if (right && node->count + right->count + 1 <= INTERNAL_CAPACITY)
+                _merge_internal(node, right);
+            else if (left)
+            {
+                // Rotate through the parent: its separator comes down to the
+                // front of node and left's last key replaces it.
+                for (size_type n = (left->count - node->count) / 2; n > 0; --n)
+                {
+                    _relocate(node->keys() + 1, node->keys(), node->count);
+                    ::new (static_cast<void *>(node->keys())) key_type(std::move(parent->keys()[i - 1]));
+                    for (size_type j = node->count + 1; j > 0; --j)
+                    {
+                        node->children[j] = node->children[j - 1];
+                        node->children[j]->position = j;
+                    }
+                    node->children[0] = left->children[left->count];
+                    node->children[0]->parent = node;
+                    node->children[0]->position = 0;
+                    parent->keys()[i - 1] = std::move(left->keys()[left->count - 1]);
+                    left->keys()[left->count - 1].~key_type();
+                    --left->count;
+                    ++node->count;
+                }
+            }
+            else
+            {
+                for (size_type n = (right->count - node->count) / 2; n > 0; --n)
+                {
+                    ::new (static_cast<void *>(node->keys() + node->count)) key_type(std::move(parent->keys()[i]));
+                    node->children[node->count + 1] = right->children[0];
+                    node->children[node->count + 1]->parent = node;
+                    node->children[node->count + 1]->position = node->count + 1;
+                    ++node->count;
+                    parent->keys()[i] = std::move(right->keys()[0]);
+                    _internal_erase_front(right);
+                }
+            }
+        }
+
+        // Drops keys[0] and children[0]; used after both were handed left.
+        void _internal_erase_front(internal_node *node)
+        {
+            node->keys()[0].~key_type();
+            _relocate(node->keys(), node->keys() + 1, node->count - 1);
+            for (size_type i = 0; i < node->count; ++i)
+            {
+                node->children[i] = node->children[i + 1];
+                node->children[i]->position = i;
+            }
+            --node->count;
+        }
+
+    private:
+        // Past-the-end of a leaf only stands for end() on the last leaf.
+        iterator _iter(leaf_node *leaf, size_type pos) const
+        {
+            if (pos == leaf->count && leaf->next)
+                return iterator(leaf->next, 0);
+            return iterator(leaf, pos);
+        }
+
+        iterator _lower_bound(const key_type &k) const
+        {
+            if (!_root)
+                return iterator();
+            leaf_node *leaf = _find_leaf(k);
+            return _iter(leaf, _lower_rank(leaf->values(), leaf->count, k, KeyOfValue()));
+        }
+
+        iterator _upper_bound(const key_type &k) const
+        {
+            if (!_root)
+                return iterator();
+            leaf_node *leaf = _find_leaf(k);
+            return _iter(leaf, _upper_rank(leaf->values(), leaf->count, k, KeyOfValue()));
+        }
+
+        iterator _end() const
+        {
+            return _root ? iterator(_last, _last->count) : iterator();
+        }
+
+        iterator _find(const key_type &k) const
+        {
+            iterator it = _lower_bound(k);
+            return it == _end() || _comp(k, _key(*it)) ? _end() : it;
+        }
+
+        template <class V>
+        struct _is_value : std::is_same<typename std::decay<V>::type, value_type>
+        {
+        };
+
+        // Anything but a value_type is converted once up front: _key reads a
+        // value_type, so a key taken from the raw argument would dangle.
+        template <class V>
+        std::pair<iterator, bool> _insert_unique(V &&v, std::false_type)
+        {
+            value_type tmp(std::forward<V>(v));
+            return _insert_unique(std::move(tmp), std::true_type());
+        }
+
+        template <class V>
+        iterator _insert_unique(const_iterator hint, V &&v, std::false_type)
+        {
+            value_type tmp(std::forward<V>(v));
+            return _insert_unique(hint, std::move(tmp), std::true_type());
+        }
+
+        template <class V>
+        std::pair<iterator, bool> _insert_unique(V &&v, std::true_type)
+        {
+            if (!_root)
+                _root = _first = _last = _new_leaf();
+            const key_type &k = _key(v);
+            leaf_node *leaf = _find_leaf(k);
+            size_type pos = _lower_rank(leaf->values(), leaf->count, k, KeyOfValue());
+            if (pos < leaf->count && !_comp(k, _key(leaf->values()[pos])))
+                return std::pair<iterator, bool>(iterator(leaf, pos), false);
+            return std::pair<iterator, bool>(_insert_at(leaf, pos, std::forward<V>(v)), true);
+        }
+
+        // Uses the hint when v belongs right before it. Inserting before the
+        // first entry of any leaf but the first still needs a search, since
+        // the separator above may belong on either side.
+        template <class V>
+        iterator _insert_unique(const_iterator hint, V &&v, std::true_type)
+        {
+            if (_size == 0)
+                return insert_unique(std::forward<V>(v)).first;
+            const key_type &k = _key(v);
+            leaf_node *leaf = hint.leaf();
+            size_type pos = hint.pos();
+            if (leaf == _last && pos == _last->count)
+            {
+                if (_comp(_key(_last->values()[pos - 1]), k))
+                    return _insert_at(leaf, pos, std::forward<V>(v));
+            }
+            else if ((pos > 0 || leaf == _first) && _comp(k, _key(leaf->values()[pos])) &&
+                     (pos == 0 || _comp(_key(leaf->values()[pos - 1]), k)))
+                return _insert_at(leaf, pos, std::forward<V>(v));
+            return insert_unique(std::forward<V>(v)).first;
+        }
+
+    public:
+        explicit btree(const key_compare &comp = key_compare(),
+                       const allocator_type &alloc = allocator_type())
+            : _comp(comp), _alloc(alloc), leaf_alloc(alloc), internal_alloc(alloc)
+        {
+            _init_empty();
+        }
+
+        btree(const btree &other)
+            : _comp(other._comp), _alloc(other._alloc), leaf_alloc(other._alloc), internal_alloc(other._alloc)
+        {
+            _init_empty();
+            try
+            {
+                insert_range_unique(other.begin(), other.end());
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        btree(btree &&other)
+            : _comp(other._comp), _alloc(other._alloc), leaf_alloc(other.leaf_alloc),
+              internal_alloc(other.internal_alloc)
+        {
+            _init_empty();
+            swap(other);
+        }
+
+        // Rebuilds from other's sorted sequence, so the copy is packed.
+        btree &operator=(const btree &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                _comp = other._comp;
+                insert_range_unique(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        btree &operator=(btree &&other)
+        {
+            if (this != &other)
+            {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~btree()
+        {
+            clear();
+        }
+
+        iterator begin() { return _root ? iterator(_first, 0) : iterator(); }
+        const_iterator begin() const { return _root ? const_iterator(_first, 0) : const_iterator(); }
+        iterator end() { return _end(); }
+        const_iterator end() const { return _end(); }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        bool empty() const { return _size == 0; }
+        size_type size() const { return _size; }
+        size_type max_size() const { return leaf_alloc.max_size() * LEAF_CAPACITY; }
+        key_compare key_comp() const { return _comp; }
+        allocator_type get_allocator() const { return _alloc; }
+
+        void clear()
+        {
+            if (!_root)
+                return;
+            if (!_root->leaf && pool_traits<leaf_allocator>::owns_pool(leaf_alloc) &&
+                pool_traits<internal_allocator>::owns_pool(internal_alloc))
+            {
+                if (!std::is_trivially_destructible<value_type>::value ||
+                    !std::is_trivially_destructible<key_type>::value)
+                    _destroy_subtree(_root, false);
+                pool_traits<leaf_allocator>::release(leaf_alloc);
+                pool_traits<internal_allocator>::release(internal_alloc);
+            }
+            else
+                _destroy_subtree(_root, true);
+            _init_empty();
+        }
+
+        void swap(btree &other)
+        {
+            std::swap(_root, other._root);
+            std::swap(_first, other._first);
+            std::swap(_last, other._last);
+            std::swap(_size, other._size);
+            std::swap(_comp, other._comp);
+            std::swap(_alloc, other._alloc);
+            std::swap(leaf_alloc, other.leaf_alloc);
+            std::swap(internal_alloc, other.internal_alloc);
+        }
+
+        template <class V>
+        std::pair<iterator, bool> insert_unique(V &&v)
+        {
+            return _insert_unique(std::forward<V>(v), _is_value<V>());
+        }
+
+        template <class V>
+        iterator insert_unique(const_iterator hint, V &&v)
+        {
+            return _insert_unique(hint, std::forward<V>(v), _is_value<V>());
+        }
+
+        // Sorted input always hits the end() hint and fills each leaf and
+        // internal node before starting the next, which bulk-loads the tree.
+        template <class InputIt>
+        void insert_range_unique(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                insert_unique(end(), *first);
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> emplace_unique(Args &&...args)
+        {
+            value_type tmp(std::forward<Args>(args)...);
+            return insert_unique(std::move(tmp));
+        }
+
+        template <class... Args>
+        iterator emplace_hint_unique(const_iterator hint, Args &&...args)
+        {
+            value_type tmp(std::forward<Args>(args)...);
+            return insert_unique(hint, std::move(tmp));
+        }
+
+        iterator erase(const_iterator it)
+        {
+            leaf_node *leaf = it.leaf();
+            size_type pos = it.pos();
+            pointer values = leaf->values();
+            values[pos].~value_type();
+            _relocate(values + pos, values + pos + 1, leaf->count - pos - 1);
+            --leaf->count;
+            --_size;
+            if (leaf == _root)
+            {
+                if (leaf->count == 0)
+                {
+                    _free_node(leaf);
+                    _init_empty();
+                }
+                return _root ? iterator(leaf, pos) : iterator();
+            }
+            leaf_node *next_leaf = leaf;
+            if (leaf->count < LEAF_CAPACITY / 2)
+                _rebalance_leaf(leaf, next_leaf, pos);
+            return _iter(next_leaf, pos);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            if (first == begin() && last == end())
+            {
+                clear();
+                return end();
+            }
+            iterator it(first.leaf(), first.pos());
+            for (difference_type n = std::distance(first, last); n > 0; --n)
+                it = erase(it);
+            return it;
+        }
+
+        size_type erase(const key_type &k)
+        {
+            iterator it = find(k);
+            if (it == end())
+                return 0;
+            erase(it);
+            return 1;
+        }
+
+        iterator find(const key_type &k) { return _find(k); }
+        const_iterator find(const key_type &k) const { return _find(k); }
+        iterator lower_bound(const key_type &k) { return _lower_bound(k); }
+        const_iterator lower_bound(const key_type &k) const { return _lower_bound(k); }
+        iterator upper_bound(const key_type &k) { return _upper_bound(k); }
+        const_iterator upper_bound(const key_type &k) const { return _upper_bound(k); }
+
+        std::pair<iterator, iterator> equal_range(const key_type &k)
+        {
+            return std::pair<iterator, iterator>(lower_bound(k), upper_bound(k));
+        }
+        std::pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+        {
+            return std::pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k));
+        }
+
+        // Calls f(first, last) on each leaf's contiguous slice of the range.
+        template <class Function>
+        Function for_each_segment(const_iterator first, const_iterator last, Function f) const
+        {
+            leaf_node *leaf = first.leaf();
+            size_type pos = first.pos();
+            while (leaf && !(leaf == last.leaf() && pos == last.pos()))
+            {
+                size_type stop = leaf == last.leaf() ? last.pos() : leaf->count;
+                f(const_pointer(leaf->values() + pos), const_pointer(leaf->values() + stop));
+                if (leaf == last.leaf())
+                    break;
+                leaf = leaf->next;
+                pos = 0;
+            }
+            return f;
+        }
+    };
+
+    template <class Key, class Value, class KeyOfValue, class Compare, class Alloc, std::size_t NodeBytes>
+    const typename btree<Key, Value, KeyOfValue, Compare, Alloc, NodeBytes>::size_type
+        btree<Key, Value, KeyOfValue, Compare, Alloc, NodeBytes>::LEAF_CAPACITY;
+
+    template <class Key, class Value, class KeyOfValue, class Compare, class Alloc, std::size_t NodeBytes>
+    const typename btree<Key, Value, KeyOfValue, Compare, Alloc, NodeBytes>::size_type
+        btree<Key, Value, KeyOfValue, Compare, Alloc, NodeBytes>::INTERNAL_CAPACITY;
+
+}
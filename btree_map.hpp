@@ -0,0 +1,224 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "btree.hpp"
+
+namespace ft
+{
+
+    // An ordered map over a B+tree of NodeBytes-wide nodes. Entries sit in
+    // packed leaf arrays, so it is far smaller than ft::map for small entries
+    // and a lookup touches one node per level. Unlike ft::map, any insert or
+    // erase invalidates iterators.
+    template <typename Key, typename T, class Compare = std::less<Key>,
+              class Alloc = std::allocator<std::pair<const Key, T>>, std::size_t NodeBytes = 256>
+    class btree_map
+    {
+    public:
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef std::pair<const Key, T> value_type;
+        typedef Compare key_compare;
+        typedef Alloc allocator_type;
+
+    private:
+        typedef btree<key_type, value_type, rb_select_first, key_compare, allocator_type, NodeBytes> tree_type;
+        tree_type _tree;
+
+    public:
+        typedef typename tree_type::size_type size_type;
+        typedef typename tree_type::difference_type difference_type;
+        typedef typename tree_type::reference reference;
+        typedef typename tree_type::const_reference const_reference;
+        typedef typename tree_type::pointer pointer;
+        typedef typename tree_type::const_pointer const_pointer;
+        typedef typename tree_type::iterator iterator;
+        typedef typename tree_type::const_iterator const_iterator;
+        typedef typename tree_type::reverse_iterator reverse_iterator;
+        typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+        class value_compare
+        {
+            friend class btree_map;
+
+        protected:
+            key_compare comp;
+            value_compare(key_compare c) : comp(c) {}
+
+        public:
+            bool operator()(const value_type &lhs, const value_type &rhs) const
+            {
+                return comp(lhs.first, rhs.first);
+            }
+        };
+
+        explicit btree_map(const key_compare &comp = key_compare(),
+                     const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc) {}
+
+        template <class InputIt>
+        btree_map(InputIt first, InputIt last, const key_compare &comp = key_compare(),
+            const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc)
+        {
+            _tree.insert_range_unique(first, last);
+        }
+
+        btree_map(std::initializer_list<value_type> il, const key_compare &comp = key_compare(),
+            const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc)
+        {
+            _tree.insert_range_unique(il.begin(), il.end());
+        }
+
+        iterator begin() { return _tree.begin(); }
+        const_iterator begin() const { return _tree.begin(); }
+        iterator end() { return _tree.end(); }
+        const_iterator end() const { return _tree.end(); }
+        reverse_iterator rbegin() { return _tree.rbegin(); }
+        const_reverse_iterator rbegin() const { return _tree.rbegin(); }
+        reverse_iterator rend() { return _tree.rend(); }
+        const_reverse_iterator rend() const { return _tree.rend(); }
+
+        bool empty() const { return _tree.empty(); }
+        size_type size() const { return _tree.size(); }
+        size_type max_size() const { return _tree.max_size(); }
+
+        mapped_type &operator[](const key_type &k)
+        {
+            iterator it = _tree.lower_bound(k);
+            if (it == end() || key_comp()(k, it->first))
+                it = _tree.emplace_hint_unique(it, k, mapped_type());
+            return it->second;
+        }
+
+        mapped_type &at(const key_type &k)
+        {
+            iterator it = _tree.find(k);
+            if (it == end())
+                throw std::out_of_range("btree_map::at");
+            return it->second;
+        }
+        const mapped_type &at(const key_type &k) const
+        {
+            const_iterator it = _tree.find(k);
+            if (it == end())
+                throw std::out_of_range("btree_map::at");
+            return it->second;
+        }
+
+        std::pair<iterator, bool> insert(const value_type &val)
+        {
+            return _tree.insert_unique(val);
+        }
+
+        iterator insert(const_iterator hint, const value_type &val)
+        {
+            return _tree.insert_unique(hint, val);
+        }
+
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            _tree.insert_range_unique(first, last);
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args)
+        {
+            return _tree.emplace_unique(std::forward<Args>(args)...);
+        }
+
+        template <class... Args>
+        iterator emplace_hint(const_iterator hint, Args &&...args)
+        {
+            return _tree.emplace_hint_unique(hint, std::forward<Args>(args)...);
+        }
+
+        iterator erase(const_iterator pos) { return _tree.erase(pos); }
+        iterator erase(iterator pos) { return _tree.erase(pos); }
+        iterator erase(const_iterator first, const_iterator last) { return _tree.erase(first, last); }
+        size_type erase(const key_type &k) { return _tree.erase(k); }
+
+        void swap(btree_map &other) { _tree.swap(other._tree); }
+        void clear() { _tree.clear(); }
+
+        key_compare key_comp() const { return _tree.key_comp(); }
+        value_compare value_comp() const { return value_compare(_tree.key_comp()); }
+        allocator_type get_allocator() const { return _tree.get_allocator(); }
+
+        iterator find(const key_type &k) { return _tree.find(k); }
+        const_iterator find(const key_type &k) const { return _tree.find(k); }
+        size_type count(const key_type &k) const { return _tree.find(k) == _tree.end() ? 0 : 1; }
+
+        iterator lower_bound(const key_type &k) { return _tree.lower_bound(k); }
+        const_iterator lower_bound(const key_type &k) const { return _tree.lower_bound(k); }
+        iterator upper_bound(const key_type &k) { return _tree.upper_bound(k); }
+        const_iterator upper_bound(const key_type &k) const { return _tree.upper_bound(k); }
+        std::pair<iterator, iterator> equal_range(const key_type &k) { return _tree.equal_range(k); }
+        std::pair<const_iterator, const_iterator> equal_range(const key_type &k) const { return _tree.equal_range(k); }
+
+        // Calls f(first, last) on each contiguous run of entries in the
+        // range, one leaf at a time.
+        template <class Function>
+        Function for_each_segment(const_iterator first, const_iterator last, Function f) const
+        {
+            return _tree.for_each_segment(first, last, f);
+        }
+
+        template <class Function>
+        Function for_each_segment(Function f) const
+        {
+            return _tree.for_each_segment(begin(), end(), f);
+        }
+    };
+
+    template <typename Key, typename T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator==(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return rb_equal(lhs, rhs);
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator!=(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator<(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return rb_less(lhs, rhs);
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator>(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator<=(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator>=(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc, std::size_t NodeBytes>
+    void swap(btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+}
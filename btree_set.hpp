@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+#include "btree.hpp"
+
+namespace ft
+{
+
+    // An ordered set over a B+tree; see btree_map. Any insert or erase
+    // invalidates iterators.
+    template <typename Key, class Compare = std::less<Key>, class Alloc = std::allocator<Key>,
+              std::size_t NodeBytes = 256>
+    class btree_set
+    {
+    public:
+        typedef Key key_type;
+        typedef Key value_type;
+        typedef Compare key_compare;
+        typedef Compare value_compare;
+        typedef Alloc allocator_type;
+
+    private:
+        typedef btree<key_type, value_type, rb_identity, key_compare, allocator_type, NodeBytes> tree_type;
+        tree_type _tree;
+
+    public:
+        typedef typename tree_type::size_type size_type;
+        typedef typename tree_type::difference_type difference_type;
+        typedef typename tree_type::reference reference;
+        typedef typename tree_type::const_reference const_reference;
+        typedef typename tree_type::pointer pointer;
+        typedef typename tree_type::const_pointer const_pointer;
+        // Keys are immutable in place, so both iterators are const.
+        typedef typename tree_type::const_iterator iterator;
+        typedef typename tree_type::const_iterator const_iterator;
+        typedef typename tree_type::const_reverse_iterator reverse_iterator;
+        typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+        explicit btree_set(const key_compare &comp = key_compare(),
+                     const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc) {}
+
+        template <class InputIt>
+        btree_set(InputIt first, InputIt last, const key_compare &comp = key_compare(),
+            const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc)
+        {
+            _tree.insert_range_unique(first, last);
+        }
+
+        btree_set(std::initializer_list<value_type> il, const key_compare &comp = key_compare(),
+            const allocator_type &alloc = allocator_type())
+            : _tree(comp, alloc)
+        {
+            _tree.insert_range_unique(il.begin(), il.end());
+        }
+
+        iterator begin() const { return _tree.begin(); }
+        iterator end() const { return _tree.end(); }
+        reverse_iterator rbegin() const { return _tree.rbegin(); }
+        reverse_iterator rend() const { return _tree.rend(); }
+
+        bool empty() const { return _tree.empty(); }
+        size_type size() const { return _tree.size(); }
+        size_type max_size() const { return _tree.max_size(); }
+
+        std::pair<iterator, bool> insert(const value_type &val)
+        {
+            std::pair<typename tree_type::iterator, bool> res = _tree.insert_unique(val);
+            return std::pair<iterator, bool>(res.first, res.second);
+        }
+
+        iterator insert(const_iterator hint, const value_type &val)
+        {
+            return _tree.insert_unique(hint, val);
+        }
+
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            _tree.insert_range_unique(first, last);
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args)
+        {
+            std::pair<typename tree_type::iterator, bool> res =
+                _tree.emplace_unique(std::forward<Args>(args)...);
+            return std::pair<iterator, bool>(res.first, res.second);
+        }
+
+        template <class... Args>
+        iterator emplace_hint(const_iterator hint, Args &&...args)
+        {
+            return _tree.emplace_hint_unique(hint, std::forward<Args>(args)...);
+        }
+
+        iterator erase(const_iterator pos) { return _tree.erase(pos); }
+        iterator erase(const_iterator first, const_iterator last) { return _tree.erase(first, last); }
+        size_type erase(const key_type &k) { return _tree.erase(k); }
+
+        void swap(btree_set &other) { _tree.swap(other._tree); }
+        void clear() { _tree.clear(); }
+
+        key_compare key_comp() const { return _tree.key_comp(); }
+        value_compare value_comp() const { return _tree.key_comp(); }
+        allocator_type get_allocator() const { return _tree.get_allocator(); }
+
+        iterator find(const key_type &k) const { return _tree.find(k); }
+        size_type count(const key_type &k) const { return _tree.find(k) == _tree.end() ? 0 : 1; }
+        iterator lower_bound(const key_type &k) const { return _tree.lower_bound(k); }
+        iterator upper_bound(const key_type &k) const { return _tree.upper_bound(k); }
+        std::pair<iterator, iterator> equal_range(const key_type &k) const { return _tree.equal_range(k); }
+
+        // Calls f(first, last) on each contiguous run of keys in the range,
+        // one leaf at a time.
+        template <class Function>
+        Function for_each_segment(const_iterator first, const_iterator last, Function f) const
+        {
+            return _tree.for_each_segment(first, last, f);
+        }
+
+        template <class Function>
+        Function for_each_segment(Function f) const
+        {
+            return _tree.for_each_segment(begin(), end(), f);
+        }
+    };
+
+    template <typename Key, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator==(const btree_set<Key, Compare, Alloc, NodeBytes> &lhs, const btree_set<Key, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return rb_equal(lhs, rhs);
+    }
+
+    template <typename Key, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator!=(const btree_set<Key, Compare, Alloc, NodeBytes> &lhs, const btree_set<Key, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Key, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator<(const btree_set<Key, Compare, Alloc, NodeBytes> &lhs, const btree_set<Key, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return rb_less(lhs, rhs);
+    }
+
+    template <typename Key, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator>(const btree_set<Key, Compare, Alloc, NodeBytes> &lhs, const btree_set<Key, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename Key, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator<=(const btree_set<Key, Compare, Alloc, NodeBytes> &lhs, const btree_set<Key, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename Key, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator>=(const btree_set<Key, Compare, Alloc, NodeBytes> &lhs, const btree_set<Key, Compare, Alloc, NodeBytes> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename Key, class Compare, class Alloc, std::size_t NodeBytes>
+    void swap(btree_set<Key, Compare, Alloc, NodeBytes> &lhs, btree_set<Key, Compare, Alloc, NodeBytes> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+}
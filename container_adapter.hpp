@@ -0,0 +1,30 @@
+#pragma once
+
+#include <utility>
+
+namespace ft
+{
+
+    // Appends [first, last) to the back of an adapter's container: through
+    // append() where the container has a bulk path (ft::deque), otherwise
+    // through a range insert at end().
+    template <class Container, class InputIt>
+    auto adapter_append(Container &c, InputIt first, InputIt last, int)
+        -> decltype(c.append(first, last), void())
+    {
+        c.append(first, last);
+    }
+
+    template <class Container, class InputIt>
+    void adapter_append(Container &c, InputIt first, InputIt last, long)
+    {
+        c.insert(c.end(), first, last);
+    }
+
+    template <class Container, class InputIt>
+    void adapter_append(Container &c, InputIt first, InputIt last)
+    {
+        adapter_append(c, first, last, 0);
+    }
+
+}
@@ -5,10 +5,29 @@
 #include <stdexcept>
 #include <iterator>
 #include <algorithm> 
+#include <cstring>
+#include <type_traits>
+#include <utility>
 
 namespace ft
 {
-    template <typename T, class Alloc = std::allocator<T>>
+    constexpr std::size_t deque_floor_pow2(std::size_t n, std::size_t p = 1)
+    {
+        return p * 2 <= n ? deque_floor_pow2(n, p * 2) : p;
+    }
+
+    // Elements per deque block: as many as fit in BlockBytes, rounded down to
+    // a power of two so iterator arithmetic becomes shifts and masks, and
+    // never fewer than 4 so large elements still share a block.
+    template <typename T, std::size_t BlockBytes>
+    struct deque_block_size
+    {
+        static const std::size_t value =
+            BlockBytes / sizeof(T) < 4 ? 4 : deque_floor_pow2(BlockBytes / sizeof(T));
+    };
+
+    template <typename T, class Alloc = std::allocator<T>,
+              std::size_t BlockBytes = 4096>
     class deque
     {
     public:
@@ -22,17 +41,25 @@ namespace ft
         typedef std::ptrdiff_t difference_type;
 
     private:
-        static const size_type BLOCK_SIZE = 64;
+        static const size_type BLOCK_SIZE = deque_block_size<T, BlockBytes>::value;
+        static const size_type SPARE_BLOCKS = 2;
 
+        // Only map[start_block..end_block] hold blocks; every other slot is
+        // NULL. Emptied blocks go to a small spare cache for reuse at either
+        // end instead of lingering in the map.
         pointer *map;                       
         size_type map_size;                 
         size_type start_block, start_index; 
         size_type end_block, end_index;   
         size_type sz;
         allocator_type alloc;
+        pointer spare[SPARE_BLOCKS];
+        size_type spare_count;
 
         pointer allocate_block()
         {
+            if (spare_count > 0)
+                return spare[--spare_count];
             return alloc.allocate(BLOCK_SIZE);
         }
 
@@ -41,6 +68,20 @@ namespace ft
             alloc.deallocate(p, BLOCK_SIZE);
         }
 
+        void release_block(pointer p)
+        {
+            if (spare_count < SPARE_BLOCKS)
+                spare[spare_count++] = p;
+            else
+                deallocate_block(p);
+        }
+
+        void release_spares()
+        {
+            while (spare_count > 0)
+                deallocate_block(spare[--spare_count]);
+        }
+
         void clear_storage()
         {
             if (map)
@@ -58,30 +99,291 @@ namespace ft
                 }
                 delete[] map;
             }
+            release_spares();
             map = NULL;
             map_size = 0;
             sz = 0;
         }
 
+        // Number of whole blocks to step for a signed in-block offset, rounding
+        // towards negative infinity.
+        static difference_type block_offset(difference_type offset)
+        {
+            const difference_type bs = static_cast<difference_type>(BLOCK_SIZE);
+            return offset >= 0 ? offset / bs : -((-offset - 1) / bs) - 1;
+        }
+
+        // Centers the used blocks in a map of new_size slots, in place when
+        // the size does not change.
+        void remap(size_type new_size)
+        {
+            size_type used = end_block - start_block + 1;
+            size_type new_start = (new_size - used) / 2;
+            if (new_size == map_size)
+            {
+                if (new_start < start_block)
+                    std::copy(map + start_block, map + end_block + 1, map + new_start);
+                else
+                    std::copy_backward(map + start_block, map + end_block + 1,
+                                       map + new_start + used);
+                std::fill(map, map + new_start, pointer(NULL));
+                std::fill(map + new_start + used, map + map_size, pointer(NULL));
+            }
+            else
+            {
+                pointer *new_map = new pointer[new_size];
+                for (size_type i = 0; i < new_size; ++i)
+                    new_map[i] = NULL;
+                std::copy(map + start_block, map + end_block + 1, new_map + new_start);
+                delete[] map;
+                map = new_map;
+                map_size = new_size;
+            }
+            start_block = new_start;
+            end_block = new_start + used - 1;
+        }
+
+        // Called when one end of the map is reached: recenters if the blocks
+        // in use fill at most half the map, doubles it otherwise.
         void grow_map()
         {
-            size_type new_size = (map_size ? map_size * 2 : 8);
-            pointer *new_map = new pointer[new_size];
-            for (size_type i = 0; i < new_size; ++i)
-                new_map[i] = NULL;
+            size_type used = end_block - start_block + 1;
+            if (used * 2 <= map_size)
+                remap(map_size);
+            else
+                remap(map_size * 2);
+        }
+
+        // Makes sure the map has at_front free slots before start_block and
+        // at_back after end_block, leaving the used blocks at most half of
+        // the map as grow_map does.
+        void reserve_map(size_type at_front, size_type at_back)
+        {
+            if (start_block >= at_front && end_block + at_back < map_size)
+                return;
+            size_type needed = end_block - start_block + 1 + at_front + at_back;
+            size_type new_size = map_size;
+            while (new_size < needed * 2)
+                new_size *= 2;
+            remap(new_size);
+        }
+
+        typedef std::integral_constant<bool, std::is_trivially_copyable<T>::value>
+            bitwise_copyable;
 
-            size_type offset = (new_size - map_size) / 2;
+        template <class It>
+        struct copies_bitwise
+            : std::integral_constant<bool,
+                                     bitwise_copyable::value && std::is_pointer<It>::value &&
+                                         std::is_same<typename std::remove_cv<
+                                                          typename std::remove_pointer<It>::type>::type,
+                                                      T>::value>
+        {
+        };
+
+        // Constructs n elements at dst from src and returns src advanced past
+        // them; on failure the elements built so far are destroyed.
+        template <class It>
+        It construct_block(pointer dst, It src, size_type n, std::true_type)
+        {
+            if (n)
+                std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src),
+                            n * sizeof(T));
+            return src + n;
+        }
+
+        template <class It>
+        It construct_block(pointer dst, It src, size_type n, std::false_type)
+        {
+            size_type i = 0;
+            try
+            {
+                for (; i < n; ++i, ++src)
+                    alloc.construct(dst + i, *src);
+            }
+            catch (...)
+            {
+                destroy_block(dst, i);
+                throw;
+            }
+            return src;
+        }
+
+        void destroy_block(pointer p, size_type n)
+        {
+            if (!std::is_trivially_destructible<T>::value)
+                for (size_type i = 0; i < n; ++i)
+                    alloc.destroy(p + i);
+        }
+
+        template <class OutputIt>
+        OutputIt move_block(pointer src, size_type n, OutputIt out, std::true_type)
+        {
+            if (n)
+                std::memcpy(static_cast<void *>(out), static_cast<const void *>(src),
+                            n * sizeof(T));
+            return out + n;
+        }
+
+        template <class OutputIt>
+        OutputIt move_block(pointer src, size_type n, OutputIt out, std::false_type)
+        {
+            return std::move(src, src + n, out);
+        }
+
+        template <class InputIt>
+        void append_range(InputIt first, InputIt last, std::input_iterator_tag)
+        {
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        template <class ForwardIt>
+        void append_range(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+        {
+            size_type n = std::distance(first, last);
+            size_type room = BLOCK_SIZE - end_index;
+            if (n > room)
+                reserve_map(0, (n - room + BLOCK_SIZE - 1) / BLOCK_SIZE);
+            while (n > 0)
+            {
+                if (end_index == BLOCK_SIZE)
+                {
+                    pointer block = allocate_block();
+                    map[++end_block] = block;
+                    end_index = 0;
+                }
+                size_type chunk = BLOCK_SIZE - end_index;
+                if (chunk > n)
+                    chunk = n;
+                first = construct_block(map[end_block] + end_index, first, chunk,
+                                        copies_bitwise<ForwardIt>());
+                end_index += chunk;
+                sz += chunk;
+                n -= chunk;
+            }
+        }
+
+        template <class InputIt>
+        void prepend_range(InputIt first, InputIt last, std::input_iterator_tag)
+        {
+            deque tmp(first, last);
+            prepend_range(tmp.begin(), tmp.end(), std::random_access_iterator_tag());
+        }
+
+        // Allocates every block the range needs up front and fills them front
+        // to back, so a throwing constructor can be fully undone.
+        template <class ForwardIt>
+        void prepend_range(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+        {
+            size_type n = std::distance(first, last);
+            if (n == 0)
+                return;
+            size_type extra = n > start_index ? (n - start_index + BLOCK_SIZE - 1) / BLOCK_SIZE : 0;
+            reserve_map(extra, 0);
+            size_type added = 0;
+            try
+            {
+                for (; added < extra; ++added)
+                    map[start_block - added - 1] = allocate_block();
+            }
+            catch (...)
+            {
+                release_front_blocks(added);
+                throw;
+            }
+            difference_type offset = static_cast<difference_type>(start_index) -
+                                     static_cast<difference_type>(n);
+            difference_type blocks = block_offset(offset);
+            size_type block = start_block + blocks;
+            size_type index = static_cast<size_type>(offset - blocks * static_cast<difference_type>(BLOCK_SIZE));
+            size_type b = block, i = index, left = n;
+            try
+            {
+                while (left > 0)
+                {
+                    size_type chunk = BLOCK_SIZE - i;
+                    if (chunk > left)
+                        chunk = left;
+                    first = construct_block(map[b] + i, first, chunk,
+                                            copies_bitwise<ForwardIt>());
+                    left -= chunk;
+                    i += chunk;
+                    if (i == BLOCK_SIZE)
+                    {
+                        ++b;
+                        i = 0;
+                    }
+                }
+            }
+            catch (...)
+            {
+                iterator built(&map[block], index);
+                for (size_type k = 0; k < n - left; ++k, ++built)
+                    alloc.destroy(&*built);
+                release_front_blocks(extra);
+                throw;
+            }
+            start_block = block;
+            start_index = index;
+            sz += n;
+        }
+
+        void release_front_blocks(size_type count)
+        {
+            for (size_type k = 1; k <= count; ++k)
+            {
+                release_block(map[start_block - k]);
+                map[start_block - k] = NULL;
+            }
+        }
+
+        void init_storage()
+        {
+            map_size = 8;
+            map = new pointer[map_size];
             for (size_type i = 0; i < map_size; ++i)
-                new_map[offset + i] = map[i];
+                map[i] = NULL;
 
-            delete[] map;
-            map = new_map;
-            start_block += offset;
-            end_block += offset;
-            map_size = new_size;
+            size_type mid = map_size / 2;
+            map[mid] = allocate_block();
+            start_block = end_block = mid;
+            start_index = end_index = 0;
+        }
+
+        // Appends the live elements of other one block run at a time, so only
+        // the blocks they need are allocated and the copy starts compacted
+        // at slot 0 of a block.
+        void append_copy(const deque &other)
+        {
+            if (other.sz == 0)
+                return;
+            reserve_map(0, other.sz / BLOCK_SIZE + 1);
+            for (size_type b = other.start_block; b <= other.end_block; ++b)
+            {
+                size_type first = b == other.start_block ? other.start_index : 0;
+                size_type last = b == other.end_block ? other.end_index : BLOCK_SIZE;
+                append(other.map[b] + first, other.map[b] + last);
+            }
+        }
+
+        // Once the last element is gone, keeps only the tail block and
+        // restarts it from slot 0 so a draining FIFO stops sliding.
+        void reset_if_empty()
+        {
+            if (sz != 0)
+                return;
+            for (; start_block < end_block; ++start_block)
+            {
+                release_block(map[start_block]);
+                map[start_block] = NULL;
+            }
+            start_index = end_index = 0;
         }
 
     public:
+        class const_iterator;
+
         class iterator
         {
         public:
@@ -92,6 +394,8 @@ namespace ft
             typedef T &reference;
 
         private:
+            friend class const_iterator;
+
             pointer *block_ptr; 
             size_type index;    
 
@@ -144,6 +448,32 @@ namespace ft
                 return tmp;
             }
 
+            iterator &operator+=(difference_type n)
+            {
+                difference_type offset = static_cast<difference_type>(index) + n;
+                difference_type blocks = block_offset(offset);
+                block_ptr += blocks;
+                index = static_cast<size_type>(offset - blocks * static_cast<difference_type>(BLOCK_SIZE));
+                return *this;
+            }
+            iterator &operator-=(difference_type n) { return *this += -n; }
+            iterator operator+(difference_type n) const
+            {
+                iterator tmp(*this);
+                return tmp += n;
+            }
+            iterator operator-(difference_type n) const
+            {
+                iterator tmp(*this);
+                return tmp -= n;
+            }
+            difference_type operator-(const iterator &other) const
+            {
+                return (block_ptr - other.block_ptr) * static_cast<difference_type>(BLOCK_SIZE) +
+                       static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+            }
+            reference operator[](difference_type n) const { return *(*this + n); }
+
             bool operator==(const iterator &other) const
             {
                 return block_ptr == other.block_ptr && index == other.index;
@@ -152,13 +482,21 @@ namespace ft
             {
                 return !(*this == other);
             }
+            bool operator<(const iterator &other) const { return *this - other < 0; }
+            bool operator>(const iterator &other) const { return other < *this; }
+            bool operator<=(const iterator &other) const { return !(other < *this); }
+            bool operator>=(const iterator &other) const { return !(*this < other); }
+
+            // One past the last slot of the block this iterator points into;
+            // [&*it, segment_end()) is contiguous.
+            pointer segment_end() const { return *block_ptr + BLOCK_SIZE; }
         };
 
         class const_iterator
         {
         public:
             typedef std::random_access_iterator_tag iterator_category;
-            typedef const T value_type;
+            typedef T value_type;
             typedef std::ptrdiff_t difference_type;
             typedef const T *pointer;
             typedef const T &reference;
@@ -169,12 +507,12 @@ namespace ft
 
         public:
             const_iterator() : block_ptr(NULL), index(0) {}
-            const_iterator(T **bp, size_type i)
+            const_iterator(T *const *bp, size_type i)
                 : block_ptr(const_cast<pointer *>(bp)), index(i) {}
             const_iterator(const const_iterator &other)
                 : block_ptr(other.block_ptr), index(other.index) {}
             const_iterator(const iterator &it)
-                : block_ptr(it.block_ptr), index(it.index) {}
+                : block_ptr(const_cast<pointer *>(it.block_ptr)), index(it.index) {}
             const_iterator &operator=(const const_iterator &other)
             {
                 block_ptr = other.block_ptr;
@@ -220,6 +558,32 @@ namespace ft
                 return tmp;
             }
 
+            const_iterator &operator+=(difference_type n)
+            {
+                difference_type offset = static_cast<difference_type>(index) + n;
+                difference_type blocks = block_offset(offset);
+                block_ptr += blocks;
+                index = static_cast<size_type>(offset - blocks * static_cast<difference_type>(BLOCK_SIZE));
+                return *this;
+            }
+            const_iterator &operator-=(difference_type n) { return *this += -n; }
+            const_iterator operator+(difference_type n) const
+            {
+                const_iterator tmp(*this);
+                return tmp += n;
+            }
+            const_iterator operator-(difference_type n) const
+            {
+                const_iterator tmp(*this);
+                return tmp -= n;
+            }
+            difference_type operator-(const const_iterator &other) const
+            {
+                return (block_ptr - other.block_ptr) * static_cast<difference_type>(BLOCK_SIZE) +
+                       static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+            }
+            reference operator[](difference_type n) const { return *(*this + n); }
+
             bool operator==(const const_iterator &other) const
             {
                 return block_ptr == other.block_ptr && index == other.index;
@@ -228,94 +592,63 @@ namespace ft
             {
                 return !(*this == other);
             }
+            bool operator<(const const_iterator &other) const { return *this - other < 0; }
+            bool operator>(const const_iterator &other) const { return other < *this; }
+            bool operator<=(const const_iterator &other) const { return !(other < *this); }
+            bool operator>=(const const_iterator &other) const { return !(*this < other); }
+
+            pointer segment_end() const { return *block_ptr + BLOCK_SIZE; }
         };
 
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
         deque()
             : map(NULL), map_size(0), start_block(0), start_index(0),
-              end_block(0), end_index(0), sz(0), alloc(Alloc())
+              end_block(0), end_index(0), sz(0), alloc(Alloc()), spare_count(0)
         {
-            map_size = 8;
-            map = new pointer[map_size];
-            for (size_type i = 0; i < map_size; ++i)
-                map[i] = NULL;
-
-            size_type mid = map_size / 2;
-            map[mid] = allocate_block();
-            start_block = end_block = mid;
-            start_index = end_index = 0;
+            init_storage();
         }
 
         template <class InputIt>
         deque(InputIt first, InputIt last)
             : map(NULL), map_size(0), start_block(0), start_index(0),
-              end_block(0), end_index(0), sz(0), alloc(Alloc())
+              end_block(0), end_index(0), sz(0), alloc(Alloc()), spare_count(0)
         {
-            map_size = 8;
-            map = new pointer[map_size];
-            for (size_type i = 0; i < map_size; ++i)
-                map[i] = NULL;
-
-            size_type mid = map_size / 2;
-            map[mid] = allocate_block();
-            start_block = end_block = mid;
-            start_index = end_index = 0;
-
-            for (; first != last; ++first)
-                push_back(*first);
+            init_storage();
+            try
+            {
+                append(first, last);
+            }
+            catch (...)
+            {
+                clear_storage();
+                throw;
+            }
         }
 
         deque(const deque &other)
             : map(NULL), map_size(0), start_block(0), start_index(0),
-              end_block(0), end_index(0), sz(0), alloc(other.alloc)
+              end_block(0), end_index(0), sz(0), alloc(other.alloc), spare_count(0)
         {
-            map_size = other.map_size;
-            map = new pointer[map_size];
-            for (size_type b = 0; b < map_size; ++b)
+            init_storage();
+            try
             {
-                if (other.map[b])
-                {
-                    map[b] = allocate_block();
-                    for (size_type i = 0; i < BLOCK_SIZE; ++i)
-                        alloc.construct(map[b] + i, other.map[b][i]);
-                }
-                else
-                    map[b] = NULL;
+                append_copy(other);
+            }
+            catch (...)
+            {
+                clear_storage();
+                throw;
             }
-
-            start_block = other.start_block;
-            start_index = other.start_index;
-            end_block = other.end_block;
-            end_index = other.end_index;
-            sz = other.sz;
         }
 
         deque &operator=(const deque &other)
         {
             if (this == &other)
                 return *this;
-            clear_storage();
-
-            alloc = other.alloc;
-            map_size = other.map_size;
-            map = new pointer[map_size];
-            for (size_type b = 0; b < map_size; ++b)
-            {
-                if (other.map[b])
-                {
-                    map[b] = allocate_block();
-                    for (size_type i = 0; i < BLOCK_SIZE; ++i)
-                        alloc.construct(map[b] + i, other.map[b][i]);
-                }
-                else
-                    map[b] = NULL;
-            }
-
-            start_block = other.start_block;
-            start_index = other.start_index;
-            end_block = other.end_block;
-            end_index = other.end_index;
-            sz = other.sz;
-
+            clear();
+            append_copy(other);
             return *this;
         }
 
@@ -327,58 +660,115 @@ namespace ft
         size_type size() const { return sz; }
         bool empty() const { return sz == 0; }
 
+        reference front() { return map[start_block][start_index]; }
+        const_reference front() const { return map[start_block][start_index]; }
+        // After pop_back empties a tail block it is kept with end_index 0,
+        // so the last element may sit at the end of the block before.
+        reference back()
+        {
+            if (end_index == 0)
+                return map[end_block - 1][BLOCK_SIZE - 1];
+            return map[end_block][end_index - 1];
+        }
+        const_reference back() const
+        {
+            if (end_index == 0)
+                return map[end_block - 1][BLOCK_SIZE - 1];
+            return map[end_block][end_index - 1];
+        }
+
         iterator begin() { return iterator(&map[start_block], start_index); }
         const_iterator begin() const
         {
             return const_iterator(&map[start_block], start_index);
         }
-        iterator end() { return iterator(&map[end_block], end_index); }
-        const_iterator end() const { return const_iterator(&map[end_block], end_index); }
 
-        void push_back(const value_type &val)
+        // push_back leaves end_index at BLOCK_SIZE until the next push, so a
+        // full tail block is reported as slot 0 of the following block, the
+        // same position ++ reaches.
+        iterator end()
+        {
+            if (end_index == BLOCK_SIZE)
+                return iterator(map + end_block + 1, 0);
+            return iterator(&map[end_block], end_index);
+        }
+        const_iterator end() const
+        {
+            if (end_index == BLOCK_SIZE)
+                return const_iterator(map + end_block + 1, 0);
+            return const_iterator(&map[end_block], end_index);
+        }
+
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        template <class... Args>
+        void emplace_back(Args &&...args)
         {
             if (end_index == BLOCK_SIZE)
             {
-                ++end_block;
-                end_index = 0;
-                if (end_block >= map_size)
+                if (end_block + 1 == map_size)
                     grow_map();
-                if (!map[end_block])
-                    map[end_block] = allocate_block();
+                pointer block = allocate_block();
+                map[++end_block] = block;
+                end_index = 0;
             }
-            alloc.construct(map[end_block] + end_index, val);
+            alloc.construct(map[end_block] + end_index, std::forward<Args>(args)...);
             ++end_index;
             ++sz;
         }
 
-        void push_front(const value_type &val)
+        void push_back(const value_type &val) { emplace_back(val); }
+        void push_back(value_type &&val) { emplace_back(std::move(val)); }
+
+        template <class... Args>
+        void emplace_front(Args &&...args)
         {
             if (start_index == 0)
             {
                 if (start_block == 0)
                     grow_map();
-                --start_block;
+                pointer block = allocate_block();
+                map[--start_block] = block;
                 start_index = BLOCK_SIZE;
-                if (!map[start_block])
-                    map[start_block] = allocate_block();
+            }
+            try
+            {
+                alloc.construct(map[start_block] + start_index - 1, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                if (start_index == BLOCK_SIZE)
+                {
+                    release_block(map[start_block]);
+                    map[start_block++] = NULL;
+                    start_index = 0;
+                }
+                throw;
             }
             --start_index;
-            alloc.construct(map[start_block] + start_index, val);
             ++sz;
         }
 
+        void push_front(const value_type &val) { emplace_front(val); }
+        void push_front(value_type &&val) { emplace_front(std::move(val)); }
+
         void pop_back()
         {
             if (sz == 0)
                 throw std::out_of_range("deque::pop_back");
             if (end_index == 0)
             {
-                --end_block;
+                release_block(map[end_block]);
+                map[end_block--] = NULL;
                 end_index = BLOCK_SIZE;
             }
             --end_index;
             alloc.destroy(map[end_block] + end_index);
             --sz;
+            reset_if_empty();
         }
 
         void pop_front()
@@ -387,12 +777,131 @@ namespace ft
                 throw std::out_of_range("deque::pop_front");
             alloc.destroy(map[start_block] + start_index);
             ++start_index;
-            if (start_index == BLOCK_SIZE)
+            --sz;
+            if (start_index == BLOCK_SIZE && sz > 0)
             {
-                ++start_block;
+                release_block(map[start_block]);
+                map[start_block++] = NULL;
                 start_index = 0;
             }
-            --sz;
+            reset_if_empty();
+        }
+
+        void clear()
+        {
+            pop_front_n(sz);
+        }
+
+        void swap(deque &other)
+        {
+            std::swap(map, other.map);
+            std::swap(map_size, other.map_size);
+            std::swap(start_block, other.start_block);
+            std::swap(start_index, other.start_index);
+            std::swap(end_block, other.end_block);
+            std::swap(end_index, other.end_index);
+            std::swap(sz, other.sz);
+            std::swap(alloc, other.alloc);
+            std::swap(spare, other.spare);
+            std::swap(spare_count, other.spare_count);
+        }
+
+        template <class InputIt>
+        void append(InputIt first, InputIt last)
+        {
+            append_range(first, last,
+                         typename std::iterator_traits<InputIt>::iterator_category());
+        }
+
+        // Inserts [first, last) before the first element, keeping its order.
+        template <class InputIt>
+        void prepend(InputIt first, InputIt last)
+        {
+            prepend_range(first, last,
+                          typename std::iterator_traits<InputIt>::iterator_category());
+        }
+
+        void pop_front_n(size_type n)
+        {
+            if (n > sz)
+                throw std::out_of_range("deque::pop_front_n");
+            while (n > 0)
+            {
+                size_type chunk = BLOCK_SIZE - start_index;
+                if (chunk > n)
+                    chunk = n;
+                destroy_block(map[start_block] + start_index, chunk);
+                start_index += chunk;
+                sz -= chunk;
+                n -= chunk;
+                if (start_index == BLOCK_SIZE && sz > 0)
+                {
+                    release_block(map[start_block]);
+                    map[start_block++] = NULL;
+                    start_index = 0;
+                }
+            }
+            reset_if_empty();
+        }
+
+        void pop_back_n(size_type n)
+        {
+            if (n > sz)
+                throw std::out_of_range("deque::pop_back_n");
+            while (n > 0)
+            {
+                if (end_index == 0)
+                {
+                    release_block(map[end_block]);
+                    map[end_block--] = NULL;
+                    end_index = BLOCK_SIZE;
+                }
+                size_type chunk = end_index - (end_block == start_block ? start_index : 0);
+                if (chunk > n)
+                    chunk = n;
+                destroy_block(map[end_block] + end_index - chunk, chunk);
+                end_index -= chunk;
+                sz -= chunk;
+                n -= chunk;
+            }
+            reset_if_empty();
+        }
+
+        // Moves up to n elements from the front into out, removes them and
+        // returns out advanced past the last element written.
+        template <class OutputIt>
+        OutputIt drain_front(size_type n, OutputIt out)
+        {
+            if (n > sz)
+                n = sz;
+            while (n > 0)
+            {
+                size_type chunk = BLOCK_SIZE - start_index;
+                if (chunk > n)
+                    chunk = n;
+                out = move_block(map[start_block] + start_index, chunk, out,
+                                 copies_bitwise<OutputIt>());
+                pop_front_n(chunk);
+                n -= chunk;
+            }
+            return out;
+        }
+
+        // Returns cached spare blocks and the empty tail block to the
+        // allocator and shrinks the map to the blocks still in use.
+        void shrink_to_fit()
+        {
+            if (end_index == 0 && end_block > start_block)
+            {
+                deallocate_block(map[end_block]);
+                map[end_block--] = NULL;
+                end_index = BLOCK_SIZE;
+            }
+            release_spares();
+            size_type used = end_block - start_block + 1;
+            size_type wanted = used + 2 < 8 ? 8 : used + 2;
+            if (wanted < map_size)
+                remap(wanted);
         }
 
         reference operator[](size_type n)
@@ -414,6 +923,93 @@ namespace ft
             size_type idx = abs_index % BLOCK_SIZE;
             return map[start_block + block_offset][idx];
         }
+
+        // Calls f(first, last) once per contiguous run of elements in
+        // [first, last), i.e. at most once per deque block.
+        template <class Function>
+        Function for_each_segment(iterator first, iterator last, Function f)
+        {
+            return walk_segments(first, last, f);
+        }
+
+        template <class Function>
+        Function for_each_segment(const_iterator first, const_iterator last, Function f) const
+        {
+            return walk_segments(first, last, f);
+        }
+
+        template <class Function>
+        Function for_each_segment(Function f)
+        {
+            return walk_segments(begin(), end(), f);
+        }
+
+        template <class Function>
+        Function for_each_segment(Function f) const
+        {
+            return walk_segments(begin(), end(), f);
+        }
+
+    private:
+        template <class Iterator, class Function>
+        static Function walk_segments(Iterator first, Iterator last, Function f)
+        {
+            typedef typename Iterator::difference_type difference_type;
+            while (first != last)
+            {
+                typename Iterator::pointer seg = &*first;
+                difference_type n = first.segment_end() - seg;
+                difference_type left = last - first;
+                if (left < n)
+                    n = left;
+                f(seg, seg + n);
+                first += n;
+            }
+            return f;
+        }
     };
 
+
+    template <typename T, class Alloc, std::size_t BlockBytes>
+    void swap(deque<T, Alloc, BlockBytes> &lhs, deque<T, Alloc, BlockBytes> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template <typename T, class Alloc, std::size_t BlockBytes>
+    bool operator==(const deque<T, Alloc, BlockBytes> &lhs, const deque<T, Alloc, BlockBytes> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename T, class Alloc, std::size_t BlockBytes>
+    bool operator!=(const deque<T, Alloc, BlockBytes> &lhs, const deque<T, Alloc, BlockBytes> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename T, class Alloc, std::size_t BlockBytes>
+    bool operator<(const deque<T, Alloc, BlockBytes> &lhs, const deque<T, Alloc, BlockBytes> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, class Alloc, std::size_t BlockBytes>
+    bool operator>(const deque<T, Alloc, BlockBytes> &lhs, const deque<T, Alloc, BlockBytes> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename T, class Alloc, std::size_t BlockBytes>
+    bool operator<=(const deque<T, Alloc, BlockBytes> &lhs, const deque<T, Alloc, BlockBytes> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename T, class Alloc, std::size_t BlockBytes>
+    bool operator>=(const deque<T, Alloc, BlockBytes> &lhs, const deque<T, Alloc, BlockBytes> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
 } 
@@ -0,0 +1,484 @@
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "vector.hpp"
+#include "flat_search.hpp"
+
+namespace ft
+{
+
+    // A map kept as two parallel sorted ft::vectors, one of keys and one of
+    // mapped values. Searches and key scans touch only the packed key array.
+    // Iterators dereference to a pair of references into both arrays rather
+    // than to a stored pair. Single inserts and erases shift both tails, so
+    // it suits tables built once and read often; bulk inserts sort the new
+    // entries and merge them in one pass.
+    template <typename Key, typename T, class Compare = std::less<Key>,
+              class Alloc = std::allocator<std::pair<Key, T>>>
+    class flat_map
+    {
+    public:
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef std::pair<Key, T> value_type;
+        typedef Compare key_compare;
+        typedef Alloc allocator_type;
+        typedef ft::vector<Key, typename Alloc::template rebind<Key>::other> key_container;
+        typedef ft::vector<T, typename Alloc::template rebind<T>::other> mapped_container;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef std::pair<const Key &, T &> reference;
+        typedef std::pair<const Key &, const T &> const_reference;
+
+        class value_compare
+        {
+            friend class flat_map;
+
+        protected:
+            key_compare comp;
+            value_compare(key_compare c) : comp(c) {}
+
+        public:
+            bool operator()(const value_type &lhs, const value_type &rhs) const
+            {
+                return comp(lhs.first, rhs.first);
+            }
+        };
+
+    private:
+        template <class Mapped>
+        class basic_iterator
+        {
+            typedef std::pair<const Key &, Mapped &> ref_type;
+
+            // operator-> needs something to point at; it hands out a
+            // pointer to a pair of references held by this proxy.
+            struct arrow
+            {
+                ref_type ref;
+                ref_type *operator->() { return &ref; }
+            };
+
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef std::pair<Key, T> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef arrow pointer;
+            typedef ref_type reference;
+
+            basic_iterator() : _key(nullptr), _mapped(nullptr) {}
+            basic_iterator(const Key *k, Mapped *m) : _key(k), _mapped(m) {}
+            template <class Other>
+            basic_iterator(const basic_iterator<Other> &other,
+                           typename std::enable_if<std::is_convertible<Other *, Mapped *>::value>::type * = 0)
+                : _key(other._key), _mapped(other._mapped) {}
+
+            reference operator*() const { return reference(*_key, *_mapped); }
+            pointer operator->() const
+            {
+                arrow a = {**this};
+                return a;
+            }
+            reference operator[](difference_type n) const { return reference(_key[n], _mapped[n]); }
+
+            basic_iterator &operator++()
+            {
+                ++_key;
+                ++_mapped;
+                return *this;
+            }
+            basic_iterator operator++(int)
+            {
+                basic_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+            basic_iterator &operator--()
+            {
+                --_key;
+                --_mapped;
+                return *this;
+            }
+            basic_iterator operator--(int)
+            {
+                basic_iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+            basic_iterator &operator+=(difference_type n)
+            {
+                _key += n;
+                _mapped += n;
+                return *this;
+            }
+            basic_iterator &operator-=(difference_type n) { return *this += -n; }
+            basic_iterator operator+(difference_type n) const { return basic_iterator(_key + n, _mapped + n); }
+            basic_iterator operator-(difference_type n) const { return basic_iterator(_key - n, _mapped - n); }
+            friend basic_iterator operator+(difference_type n, const basic_iterator &it) { return it + n; }
+
+            template <class Other>
+            difference_type operator-(const basic_iterator<Other> &other) const { return _key - other._key; }
+            template <class Other>
+            bool operator==(const basic_iterator<Other> &other) const { return _key == other._key; }
+            template <class Other>
+            bool operator!=(const basic_iterator<Other> &other) const { return _key != other._key; }
+            template <class Other>
+            bool operator<(const basic_iterator<Other> &other) const { return _key < other._key; }
+            template <class Other>
+            bool operator>(const basic_iterator<Other> &other) const { return _key > other._key; }
+            template <class Other>
+            bool operator<=(const basic_iterator<Other> &other) const { return _key <= other._key; }
+            template <class Other>
+            bool operator>=(const basic_iterator<Other> &other) const { return _key >= other._key; }
+
+        private:
+            template <class>
+            friend class basic_iterator;
+            friend class flat_map;
+
+            const Key *_key;
+            Mapped *_mapped;
+        };
+
+    public:
+        typedef basic_iterator<T> iterator;
+        typedef basic_iterator<const T> const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    private:
+        key_container _keys;
+        mapped_container _values;
+        key_compare _comp;
+
+        size_type _lower_index(const key_type &k) const
+        {
+            return flat_lower_bound(_keys.data(), _keys.size(), k, _comp);
+        }
+
+        size_type _upper_index(const key_type &k) const
+        {
+            return flat_upper_bound(_keys.data(), _keys.size(), k, _comp);
+        }
+
+        iterator _at(size_type i) { return iterator(_keys.data() + i, _values.data() + i); }
+        const_iterator _at(size_type i) const { return const_iterator(_keys.data() + i, _values.data() + i); }
+
+        template <class K, class... Args>
+        iterator _insert_at(size_type i, K &&k, Args &&...args)
+        {
+            _keys.insert(_keys.begin() + i, std::forward<K>(k));
+            try
+            {
+                _values.emplace(_values.begin() + i, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                _keys.erase(_keys.begin() + i);
+                throw;
+            }
+            return _at(i);
+        }
+
+        // Merges sorted entries into both arrays in one pass. On equal keys
+        // an entry already in the map wins, then the earliest new one. Both
+        // arrays are reserved up front and existing entries are copied unless
+        // their move cannot throw, so a failure leaves the map untouched.
+        void _merge_sorted(value_type *first, value_type *last)
+        {
+            key_container keys(_keys.get_allocator());
+            mapped_container values(_values.get_allocator());
+            keys.reserve(_keys.size() + (last - first));
+            values.reserve(_keys.size() + (last - first));
+            size_type i = 0, n = _keys.size();
+            for (; first != last; ++first)
+            {
+                while (i < n && _comp(_keys[i], first->first))
+                {
+                    keys.push_back(std::move_if_noexcept(_keys[i]));
+                    values.push_back(std::move_if_noexcept(_values[i]));
+                    ++i;
+                }
+                if ((i < n && !_comp(first->first, _keys[i])) ||
+                    (!keys.empty() && !_comp(keys.back(), first->first)))
+                    continue;
+                keys.push_back(std::move(first->first));
+                values.push_back(std::move(first->second));
+            }
+            for (; i < n; ++i)
+            {
+                keys.push_back(std::move_if_noexcept(_keys[i]));
+                values.push_back(std::move_if_noexcept(_values[i]));
+            }
+            _keys.swap(keys);
+            _values.swap(values);
+        }
+
+    public:
+        explicit flat_map(const key_compare &comp = key_compare(),
+                          const allocator_type &alloc = allocator_type())
+            : _keys(typename key_container::allocator_type(alloc)),
+              _values(typename mapped_container::allocator_type(alloc)), _comp(comp) {}
+
+        template <class InputIt>
+        flat_map(InputIt first, InputIt last, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type())
+            : _keys(typename key_container::allocator_type(alloc)),
+              _values(typename mapped_container::allocator_type(alloc)), _comp(comp)
+        {
+            insert(first, last);
+        }
+
+        template <class InputIt>
+        flat_map(sorted_unique_t, InputIt first, InputIt last, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type())
+            : _keys(typename key_container::allocator_type(alloc)),
+              _values(typename mapped_container::allocator_type(alloc)), _comp(comp)
+        {
+            for (; first != last; ++first)
+            {
+                _keys.push_back(first->first);
+                _values.push_back(first->second);
+            }
+        }
+
+        flat_map(std::initializer_list<value_type> il, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type())
+            : _keys(typename key_container::allocator_type(alloc)),
+              _values(typename mapped_container::allocator_type(alloc)), _comp(comp)
+        {
+            insert(il.begin(), il.end());
+        }
+
+        iterator begin() { return _at(0); }
+        const_iterator begin() const { return _at(0); }
+        iterator end() { return _at(_keys.size()); }
+        const_iterator end() const { return _at(_keys.size()); }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        bool empty() const { return _keys.empty(); }
+        size_type size() const { return _keys.size(); }
+        size_type max_size() const { return std::min(_keys.max_size(), _values.max_size()); }
+        void reserve(size_type n)
+        {
+            _keys.reserve(n);
+            _values.reserve(n);
+        }
+        void shrink_to_fit()
+        {
+            _keys.shrink_to_fit();
+            _values.shrink_to_fit();
+        }
+
+        // The two sorted arrays, for scans that want plain contiguous data.
+        const key_container &keys() const { return _keys; }
+        const mapped_container &values() const { return _values; }
+
+        mapped_type &operator[](const key_type &k)
+        {
+            size_type i = _lower_index(k);
+            if (i == _keys.size() || _comp(k, _keys[i]))
+                _insert_at(i, k);
+            return _values[i];
+        }
+
+        mapped_type &at(const key_type &k)
+        {
+            iterator it = find(k);
+            if (it == end())
+                throw std::out_of_range("flat_map::at");
+            return it->second;
+        }
+        const mapped_type &at(const key_type &k) const
+        {
+            const_iterator it = find(k);
+            if (it == end())
+                throw std::out_of_range("flat_map::at");
+            return it->second;
+        }
+
+        std::pair<iterator, bool> insert(const value_type &val)
+        {
+            size_type i = _lower_index(val.first);
+            if (i < _keys.size() && !_comp(val.first, _keys[i]))
+                return std::pair<iterator, bool>(_at(i), false);
+            return std::pair<iterator, bool>(_insert_at(i, val.first, val.second), true);
+        }
+
+        std::pair<iterator, bool> insert(value_type &&val)
+        {
+            size_type i = _lower_index(val.first);
+            if (i < _keys.size() && !_comp(val.first, _keys[i]))
+                return std::pair<iterator, bool>(_at(i), false);
+            return std::pair<iterator, bool>(_insert_at(i, std::move(val.first), std::move(val.second)), true);
+        }
+
+        // The hint is used when val belongs right before it.
+        iterator insert(const_iterator hint, const value_type &val)
+        {
+            size_type i = hint - begin();
+            if ((i == 0 || _comp(_keys[i - 1], val.first)) && (i == _keys.size() || _comp(val.first, _keys[i])))
+                return _insert_at(i, val.first, val.second);
+            return insert(val).first;
+        }
+
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            ft::vector<value_type, allocator_type> incoming(get_allocator());
+            for (; first != last; ++first)
+                incoming.push_back(value_type(first->first, first->second));
+            value_type *base = incoming.data();
+            const key_compare &comp = _comp;
+            std::stable_sort(base, base + incoming.size(), [&comp](const value_type &a, const value_type &b)
+                             { return comp(a.first, b.first); });
+            _merge_sorted(base, base + incoming.size());
+        }
+
+        void insert(std::initializer_list<value_type> il)
+        {
+            insert(il.begin(), il.end());
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args)
+        {
+            return insert(value_type(std::forward<Args>(args)...));
+        }
+
+        // Constructs the mapped value in place only if k is absent.
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(const key_type &k, Args &&...args)
+        {
+            size_type i = _lower_index(k);
+            if (i < _keys.size() && !_comp(k, _keys[i]))
+                return std::pair<iterator, bool>(_at(i), false);
+            return std::pair<iterator, bool>(_insert_at(i, k, std::forward<Args>(args)...), true);
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            size_type i = pos - begin();
+            _keys.erase(_keys.begin() + i);
+            _values.erase(_values.begin() + i);
+            return _at(i);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            size_type i = first - begin();
+            size_type j = last - begin();
+            _keys.erase(_keys.begin() + i, _keys.begin() + j);
+            _values.erase(_values.begin() + i, _values.begin() + j);
+            return _at(i);
+        }
+
+        size_type erase(const key_type &k)
+        {
+            const_iterator it = find(k);
+            if (it == end())
+                return 0;
+            erase(it);
+            return 1;
+        }
+
+        void swap(flat_map &other)
+        {
+            _keys.swap(other._keys);
+            _values.swap(other._values);
+            std::swap(_comp, other._comp);
+        }
+
+        void clear()
+        {
+            _keys.clear();
+            _values.clear();
+        }
+
+        key_compare key_comp() const { return _comp; }
+        value_compare value_comp() const { return value_compare(_comp); }
+        allocator_type get_allocator() const { return allocator_type(_keys.get_allocator()); }
+
+        iterator find(const key_type &k)
+        {
+            size_type i = _lower_index(k);
+            return i == _keys.size() || _comp(k, _keys[i]) ? end() : _at(i);
+        }
+        const_iterator find(const key_type &k) const
+        {
+            size_type i = _lower_index(k);
+            return i == _keys.size() || _comp(k, _keys[i]) ? end() : _at(i);
+        }
+        size_type count(const key_type &k) const { return find(k) == end() ? 0 : 1; }
+
+        iterator lower_bound(const key_type &k) { return _at(_lower_index(k)); }
+        const_iterator lower_bound(const key_type &k) const { return _at(_lower_index(k)); }
+        iterator upper_bound(const key_type &k) { return _at(_upper_index(k)); }
+        const_iterator upper_bound(const key_type &k) const { return _at(_upper_index(k)); }
+        std::pair<iterator, iterator> equal_range(const key_type &k)
+        {
+            return std::pair<iterator, iterator>(lower_bound(k), upper_bound(k));
+        }
+        std::pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+        {
+            return std::pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k));
+        }
+    };
+
+    template <typename Key, typename T, class Compare, class Alloc>
+    bool operator==(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return lhs.size() == rhs.size() &&
+               std::equal(lhs.keys().begin(), lhs.keys().end(), rhs.keys().begin()) &&
+               std::equal(lhs.values().begin(), lhs.values().end(), rhs.values().begin());
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc>
+    bool operator!=(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc>
+    bool operator<(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc>
+    bool operator>(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc>
+    bool operator<=(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc>
+    bool operator>=(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename Key, typename T, class Compare, class Alloc>
+    void swap(flat_map<Key, T, Compare, Alloc> &lhs, flat_map<Key, T, Compare, Alloc> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ft
+{
+
+    // Tag for flat container constructors whose input is already sorted and
+    // free of duplicate keys; the sort and dedup pass is skipped.
+    struct sorted_unique_t
+    {
+    };
+    const sorted_unique_t sorted_unique = sorted_unique_t();
+
+    // Binary searches over a sorted array that halve the range with a
+    // conditional move instead of a branch, so hot lookups in read-mostly
+    // tables don't stall on mispredictions. Both return an index.
+    template <class T, class K, class Compare>
+    std::size_t flat_lower_bound(const T *first, std::size_t n, const K &k, Compare comp)
+    {
+        if (n == 0)
+            return 0;
+        const T *base = first;
+        while (n > 1)
+        {
+            std::size_t half = n / 2;
+            base = comp(base[half], k) ? base + half : base;
+            n -= half;
+        }
+        return (base - first) + comp(*base, k);
+    }
+
+    template <class T, class K, class Compare>
+    std::size_t flat_upper_bound(const T *first, std::size_t n, const K &k, Compare comp)
+    {
+        if (n == 0)
+            return 0;
+        const T *base = first;
+        while (n > 1)
+        {
+            std::size_t half = n / 2;
+            base = comp(k, base[half]) ? base : base + half;
+            n -= half;
+        }
+        return (base - first) + !comp(k, *base);
+    }
+
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+#include "vector.hpp"
+#include "flat_search.hpp"
+
+namespace ft
+{
+
+    // A set kept as one sorted ft::vector of keys. Lookups binary search
+    // contiguous memory and iteration is a plain array walk; single inserts
+    // and erases shift the tail, so it suits tables built once and read
+    // often. Bulk inserts sort the new keys and merge them in one pass.
+    template <typename Key, class Compare = std::less<Key>, class Alloc = std::allocator<Key>>
+    class flat_set
+    {
+    public:
+        typedef Key key_type;
+        typedef Key value_type;
+        typedef Compare key_compare;
+        typedef Compare value_compare;
+        typedef Alloc allocator_type;
+        typedef ft::vector<Key, Alloc> container_type;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const Key &reference;
+        typedef const Key &const_reference;
+        typedef const Key *pointer;
+        typedef const Key *const_pointer;
+        typedef typename container_type::const_iterator iterator;
+        typedef typename container_type::const_iterator const_iterator;
+        typedef typename container_type::const_reverse_iterator reverse_iterator;
+        typedef typename container_type::const_reverse_iterator const_reverse_iterator;
+
+    private:
+        container_type _keys;
+        key_compare _comp;
+
+        size_type _lower_index(const key_type &k) const
+        {
+            return flat_lower_bound(_keys.data(), _keys.size(), k, _comp);
+        }
+
+        size_type _upper_index(const key_type &k) const
+        {
+            return flat_upper_bound(_keys.data(), _keys.size(), k, _comp);
+        }
+
+        iterator _at(size_type i) const { return _keys.begin() + i; }
+
+        // Sorts the keys appended from old_size on, merges them into the
+        // sorted prefix and drops duplicates, keeping the earliest copy.
+        void _merge_tail(size_type old_size)
+        {
+            key_type *base = _keys.data();
+            key_type *mid = base + old_size;
+            key_type *end = base + _keys.size();
+            std::stable_sort(mid, end, _comp);
+            std::inplace_merge(base, mid, end, _comp);
+            const key_compare &comp = _comp;
+            key_type *last = std::unique(base, end, [&comp](const key_type &a, const key_type &b)
+                                         { return !comp(a, b); });
+            _keys.erase(_keys.begin() + (last - base), _keys.end());
+        }
+
+    public:
+        explicit flat_set(const key_compare &comp = key_compare(),
+                          const allocator_type &alloc = allocator_type())
+            : _keys(alloc), _comp(comp) {}
+
+        template <class InputIt>
+        flat_set(InputIt first, InputIt last, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type())
+            : _keys(alloc), _comp(comp)
+        {
+            insert(first, last);
+        }
+
+        template <class InputIt>
+        flat_set(sorted_unique_t, InputIt first, InputIt last, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type())
+            : _keys(first, last, alloc), _comp(comp) {}
+
+        flat_set(std::initializer_list<value_type> il, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type())
+            : _keys(alloc), _comp(comp)
+        {
+            insert(il.begin(), il.end());
+        }
+
+        iterator begin() const { return _keys.begin(); }
+        iterator end() const { return _keys.end(); }
+        reverse_iterator rbegin() const { return _keys.rbegin(); }
+        reverse_iterator rend() const { return _keys.rend(); }
+
+        bool empty() const { return _keys.empty(); }
+        size_type size() const { return _keys.size(); }
+        size_type max_size() const { return _keys.max_size(); }
+        size_type capacity() const { return _keys.capacity(); }
+        void reserve(size_type n) { _keys.reserve(n); }
+        void shrink_to_fit() { _keys.shrink_to_fit(); }
+
+        // The sorted keys themselves, for scans that want a plain array.
+        const container_type &keys() const { return _keys; }
+
+        std::pair<iterator, bool> insert(const value_type &val)
+        {
+            size_type i = _lower_index(val);
+            if (i < _keys.size() && !_comp(val, _keys[i]))
+                return std::pair<iterator, bool>(_at(i), false);
+            _keys.insert(_keys.begin() + i, val);
+            return std::pair<iterator, bool>(_at(i), true);
+        }
+
+        // The hint is used when val belongs right before it.
+        iterator insert(const_iterator hint, const value_type &val)
+        {
+            size_type i = hint - begin();
+            if ((i == 0 || _comp(_keys[i - 1], val)) && (i == _keys.size() || _comp(val, _keys[i])))
+            {
+                _keys.insert(_keys.begin() + i, val);
+                return _at(i);
+            }
+            return insert(val).first;
+        }
+
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            size_type old_size = _keys.size();
+            for (; first != last; ++first)
+                _keys.push_back(*first);
+            _merge_tail(old_size);
+        }
+
+        void insert(std::initializer_list<value_type> il)
+        {
+            insert(il.begin(), il.end());
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args)
+        {
+            return insert(value_type(std::forward<Args>(args)...));
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            size_type i = pos - begin();
+            _keys.erase(_keys.begin() + i);
+            return _at(i);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            size_type i = first - begin();
+            _keys.erase(_keys.begin() + i, _keys.begin() + (last - begin()));
+            return _at(i);
+        }
+
+        size_type erase(const key_type &k)
+        {
+            const_iterator it = find(k);
+            if (it == end())
+                return 0;
+            erase(it);
+            return 1;
+        }
+
+        void swap(flat_set &other)
+        {
+            _keys.swap(other._keys);
+            std::swap(_comp, other._comp);
+        }
+
+        void clear() { _keys.clear(); }
+
+        key_compare key_comp() const { return _comp; }
+        value_compare value_comp() const { return _comp; }
+        allocator_type get_allocator() const { return _keys.get_allocator(); }
+
+        iterator find(const key_type &k) const
+        {
+            size_type i = _lower_index(k);
+            return i == _keys.size() || _comp(k, _keys[i]) ? end() : _at(i);
+        }
+        size_type count(const key_type &k) const { return find(k) == end() ? 0 : 1; }
+        iterator lower_bound(const key_type &k) const { return _at(_lower_index(k)); }
+        iterator upper_bound(const key_type &k) const { return _at(_upper_index(k)); }
+        std::pair<iterator, iterator> equal_range(const key_type &k) const
+        {
+            return std::pair<iterator, iterator>(lower_bound(k), upper_bound(k));
+        }
+    };
+
+    template <typename Key, class Compare, class Alloc>
+    bool operator==(const flat_set<Key, Compare, Alloc> &lhs, const flat_set<Key, Compare, Alloc> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename Key, class Compare, class Alloc>
+    bool operator!=(const flat_set<Key, Compare, Alloc> &lhs, const flat_set<Key, Compare, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Key, class Compare, class Alloc>
+    bool operator<(const flat_set<Key, Compare, Alloc> &lhs, const flat_set<Key, Compare, Alloc> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename Key, class Compare, class Alloc>
+    bool operator>(const flat_set<Key, Compare, Alloc> &lhs, const flat_set<Key, Compare, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename Key, class Compare, class Alloc>
+    bool operator<=(const flat_set<Key, Compare, Alloc> &lhs, const flat_set<Key, Compare, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename Key, class Compare, class Alloc>
+    bool operator>=(const flat_set<Key, Compare, Alloc> &lhs, const flat_set<Key, Compare, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename Key, class Compare, class Alloc>
+    void swap(flat_set<Key, Compare, Alloc> &lhs, flat_set<Key, Compare, Alloc> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+}
@@ -0,0 +1,698 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "rb_tree.hpp"
+
+#if defined(__SSE2__)
+#define FT_HASH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace ft
+{
+
+    // Sixteen control bytes probed at once. An empty slot holds -128 and a
+    // full one the low seven bits of its hash, so one compare finds every
+    // candidate slot for a key and the sign bits mark the empty ones.
+    struct hash_group
+    {
+        static const std::size_t width = 16;
+        static const signed char empty = -128;
+        // Marks slots a range erase has emptied but not yet repaired.
+        static const signed char doomed = -2;
+
+#ifdef FT_HASH_SSE2
+        __m128i ctrl;
+
+        explicit hash_group(const signed char *p)
+            : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))) {}
+
+        unsigned match(signed char h2) const
+        {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl));
+        }
+
+        unsigned match_empty() const
+        {
+            return _mm_movemask_epi8(ctrl);
+        }
+#else
+        const signed char *ctrl;
+
+        explicit hash_group(const signed char *p) : ctrl(p) {}
+
+        unsigned match(signed char h2) const
+        {
+            unsigned mask = 0;
+            for (std::size_t i = 0; i < width; ++i)
+                mask |= unsigned(ctrl[i] == h2) << i;
+            return mask;
+        }
+
+        unsigned match_empty() const
+        {
+            unsigned mask = 0;
+            for (std::size_t i = 0; i < width; ++i)
+                mask |= unsigned(ctrl[i] < 0) << i;
+            return mask;
+        }
+#endif
+    };
+
+    inline unsigned hash_lowest_bit(unsigned mask)
+    {
+#if defined(__GNUC__)
+        return __builtin_ctz(mask);
+#else
+        unsigned i = 0;
+        for (; !(mask & 1); mask >>= 1)
+            ++i;
+        return i;
+#endif
+    }
+
+    // Spreads a std::hash result over all bits; std::hash of an integer is
+    // the integer itself, which would leave the control bytes all alike.
+    inline std::size_t hash_mix(std::size_t h)
+    {
+        unsigned long long m = static_cast<unsigned long long>(h) * 0x9E3779B97F4A7C15ull;
+        return static_cast<std::size_t>(m ^ (m >> 32));
+    }
+
+    // True when both Hash and KeyEqual declare is_transparent, which lets
+    // the containers look keys up by any type the two accept.
+    template <class Hash, class KeyEqual, class = void>
+    struct hash_is_transparent : std::false_type
+    {
+    };
+
+    template <class Hash, class KeyEqual>
+    struct hash_is_transparent<Hash, KeyEqual,
+                               typename std::conditional<true, void,
+                                                         std::pair<typename Hash::is_transparent,
+                                                                   typename KeyEqual::is_transparent>>::type>
+        : std::true_type
+    {
+    };
+
+    // The open-addressing table behind ft::unordered_map and
+    // ft::unordered_set. Keys are probed linearly from their home slot,
+    // sixteen control bytes at a time. Erase shifts the rest of the run back
+    // instead of leaving a tombstone, so probes never lengthen with churn.
+    // Iteration starts just past an empty slot (the origin), which keeps
+    // every run contiguous in iteration order: the shift after erase(it)
+    // only moves unvisited entries, and never behind the iterator.
+    template <class Key, class Value, class KeyOfValue, class Hash, class KeyEqual,
+              class Alloc = std::allocator<Value>>
+    class hash_table
+    {
+    public:
+        typedef Key key_type;
+        typedef Value value_type;
+        typedef Hash hasher;
+        typedef KeyEqual key_equal;
+        typedef Alloc allocator_type;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef value_type &reference;
+        typedef const value_type &const_reference;
+        typedef value_type *pointer;
+        typedef const value_type *const_pointer;
+
+        static const size_type min_capacity = hash_group::width;
+
+    private:
+        typedef typename Alloc::template rebind<signed char>::other ctrl_allocator;
+
+        // Slot i's control byte is mirrored at capacity + i for i < 15, so a
+        // group load starting anywhere reads past the end without wrapping.
+        signed char *_ctrl;
+        pointer _slots;
+        size_type _capacity;
+        size_type _size;
+        size_type _origin;
+        hasher _hash;
+        key_equal _eq;
+        allocator_type _alloc;
+        ctrl_allocator ctrl_alloc;
+
+        static signed char *_empty_ctrl()
+        {
+            static const signed char group[hash_group::width] = {
+                hash_group::empty, hash_group::empty, hash_group::empty, hash_group::empty,
+                hash_group::empty, hash_group::empty, hash_group::empty, hash_group::empty,
+                hash_group::empty, hash_group::empty, hash_group::empty, hash_group::empty,
+                hash_group::empty, hash_group::empty, hash_group::empty, hash_group::empty};
+            return const_cast<signed char *>(group);
+        }
+
+        static const key_type &_key(const value_type &v) { return KeyOfValue()(v); }
+
+        size_type _mask() const { return _capacity ? _capacity - 1 : 0; }
+
+        // Grows at 7/8 full.
+        static size_type _max_load(size_type capacity) { return capacity - capacity / 8; }
+
+        template <class K>
+        size_type _hash_of(const K &k) const { return hash_mix(_hash(k)); }
+
+        static signed char _h2(size_type h) { return static_cast<signed char>(h & 0x7F); }
+        size_type _home(size_type h) const { return (h >> 7) & _mask(); }
+
+        bool _full(size_type i) const { return _ctrl[i] >= 0; }
+
+        void _set_ctrl(size_type i, signed char c)
+        {
+            _ctrl[i] = c;
+            if (i < hash_group::width - 1)
+                _ctrl[_capacity + i] = c;
+        }
+
+        size_type _next_full(size_type i) const
+        {
+            size_type mask = _mask();
+            do
+                i = (i + 1) & mask;
+            while (i != _origin && !_full(i));
+            return i;
+        }
+
+        size_type _next_empty(size_type i) const
+        {
+            size_type mask = _mask();
+            do
+                i = (i + 1) & mask;
+            while (_full(i));
+            return i;
+        }
+
+        // Index of the slot holding k, or _capacity when it is absent.
+        template <class K>
+        size_type _find_index(const K &k, size_type h) const
+        {
+            size_type mask = _mask();
+            size_type pos = _home(h);
+            signed char h2 = _h2(h);
+            for (;;)
+            {
+                hash_group group(_ctrl + pos);
+                for (unsigned m = group.match(h2); m; m &= m - 1)
+                {
+                    size_type i = (pos + hash_lowest_bit(m)) & mask;
+                    if (_eq(_key(_slots[i]), k))
+                        return i;
+                }
+                if (group.match_empty())
+                    return _capacity;
+                pos = (pos + hash_group::width) & mask;
+            }
+        }
+
+        // With no tombstones the first empty slot from home ends the run.
+        size_type _insert_index(size_type h) const
+        {
+            size_type mask = _mask();
+            size_type pos = _home(h);
+            for (;;)
+            {
+                unsigned empties = hash_group(_ctrl + pos).match_empty();
+                if (empties)
+                    return (pos + hash_lowest_bit(empties)) & mask;
+                pos = (pos + hash_group::width) & mask;
+            }
+        }
+
+        void _allocate(size_type capacity)
+        {
+            _capacity = capacity;
+            _size = 0;
+            _origin = 0;
+            if (!capacity)
+            {
+                _ctrl = _empty_ctrl();
+                _slots = nullptr;
+                return;
+            }
+            _ctrl = ctrl_alloc.allocate(capacity + hash_group::width - 1);
+            try
+            {
+                _slots = _alloc.allocate(capacity);
+            }
+            catch (...)
+            {
+                ctrl_alloc.deallocate(_ctrl, capacity + hash_group::width - 1);
+                _allocate(0);
+                throw;
+            }
+            std::memset(_ctrl, static_cast<unsigned char>(hash_group::empty),
+                        capacity + hash_group::width - 1);
+        }
+
+        void _deallocate()
+        {
+            if (!_capacity)
+                return;
+            ctrl_alloc.deallocate(_ctrl, _capacity + hash_group::width - 1);
+            _alloc.deallocate(_slots, _capacity);
+        }
+
+        void _destroy_all()
+        {
+            if (std::is_trivially_destructible<value_type>::value)
+                return;
+            for (size_type i = 0; i < _capacity; ++i)
+                if (_full(i))
+                    _alloc.destroy(_slots + i);
+        }
+
+        // Smallest power-of-two capacity that holds n entries under the
+        // load limit.
+        static size_type _capacity_for(size_type n)
+        {
+            size_type capacity = min_capacity;
+            while (_max_load(capacity) < n)
+                capacity *= 2;
+            return capacity;
+        }
+
+        void _rehash(size_type capacity)
+        {
+            signed char *old_ctrl = _ctrl;
+            pointer old_slots = _slots;
+            size_type old_capacity = _capacity;
+            size_type old_size = _size;
+            _allocate(capacity);
+            for (size_type i = 0; i < old_capacity; ++i)
+            {
+                if (old_ctrl[i] < 0)
+                    continue;
+                size_type h = _hash_of(_key(old_slots[i]));
+                size_type j = _insert_index(h);
+                _alloc.construct(_slots + j, std::move_if_noexcept(old_slots[i]));
+                _alloc.destroy(old_slots + i);
+                _set_ctrl(j, _h2(h));
+            }
+            _size = old_size;
+            _origin = _next_empty(_mask());
+            if (old_capacity)
+            {
+                ctrl_alloc.deallocate(old_ctrl, old_capacity + hash_group::width - 1);
+                _alloc.deallocate(old_slots, old_capacity);
+            }
+        }
+
+        // Empties slot i, then pulls later entries of its run back into the
+        // hole whenever their home slot allows it.
+        void _erase_index(size_type i)
+        {
+            size_type mask = _mask();
+            _alloc.destroy(_slots + i);
+            size_type hole = i;
+            for (size_type j = (i + 1) & mask; _full(j); j = (j + 1) & mask)
+            {
+                size_type home = _home(_hash_of(_key(_slots[j])));
+                if (((j - home) & mask) < ((j - hole) & mask))
+                    continue;
+                _alloc.construct(_slots + hole, std::move(_slots[j]));
+                _alloc.destroy(_slots + j);
+                _set_ctrl(hole, _ctrl[j]);
+                hole = j;
+            }
+            _set_ctrl(hole, hash_group::empty);
+            --_size;
+        }
+
+        void _copy_from(const hash_table &other)
+        {
+            _allocate(other._capacity);
+            if (!_capacity)
+                return;
+            size_type i = 0;
+            try
+            {
+                for (; i < _capacity; ++i)
+                    if (other._full(i))
+                        _alloc.construct(_slots + i, other._slots[i]);
+            }
+            catch (...)
+            {
+                while (i-- > 0)
+                    if (other._full(i))
+                        _alloc.destroy(_slots + i);
+                _deallocate();
+                _allocate(0);
+                throw;
+            }
+            std::memcpy(_ctrl, other._ctrl, _capacity + hash_group::width - 1);
+            _size = other._size;
+            _origin = other._origin;
+        }
+
+    public:
+        class const_iterator;
+
+        class iterator
+        {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef Value value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef Value *pointer;
+            typedef Value &reference;
+
+            iterator() : _table(nullptr), _index(0) {}
+            iterator(const hash_table *table, size_type index)
+                : _table(const_cast<hash_table *>(table)), _index(index) {}
+
+            reference operator*() const { return _table->_slots[_index]; }
+            pointer operator->() const { return _table->_slots + _index; }
+
+            iterator &operator++()
+            {
+                _index = _table->_next_full(_index);
+                return *this;
+            }
+            iterator operator++(int)
+            {
+                iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+
+            bool operator==(const iterator &other) const { return _index == other._index; }
+            bool operator!=(const iterator &other) const { return _index != other._index; }
+
+            size_type index() const { return _index; }
+
+        private:
+            friend class const_iterator;
+
+            hash_table *_table;
+            size_type _index;
+        };
+
+        class const_iterator
+        {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef Value value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const Value *pointer;
+            typedef const Value &reference;
+
+            const_iterator() : _table(nullptr), _index(0) {}
+            const_iterator(const hash_table *table, size_type index) : _table(table), _index(index) {}
+            const_iterator(const iterator &other) : _table(other._table), _index(other.index()) {}
+
+            reference operator*() const { return _table->_slots[_index]; }
+            pointer operator->() const { return _table->_slots + _index; }
+
+            const_iterator &operator++()
+            {
+                _index = _table->_next_full(_index);
+                return *this;
+            }
+            const_iterator operator++(int)
+            {
+                const_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+
+            bool operator==(const const_iterator &other) const { return _index == other._index; }
+            bool operator!=(const const_iterator &other) const { return _index != other._index; }
+
+            size_type index() const { return _index; }
+
+        private:
+            const hash_table *_table;
+            size_type _index;
+        };
+
+        explicit hash_table(size_type bucket_count = 0, const hasher &hash = hasher(),
+                            const key_equal &eq = key_equal(),
+                            const allocator_type &alloc = allocator_type())
+            : _hash(hash), _eq(eq), _alloc(alloc), ctrl_alloc(alloc)
+        {
+            _allocate(bucket_count ? _capacity_for(bucket_count) : 0);
+        }
+
+        hash_table(const hash_table &other)
+            : _hash(other._hash), _eq(other._eq), _alloc(other._alloc), ctrl_alloc(other._alloc)
+        {
+            _copy_from(other);
+        }
+
+        hash_table(hash_table &&other)
+            : _hash(other._hash), _eq(other._eq), _alloc(other._alloc), ctrl_alloc(other.ctrl_alloc)
+        {
+            _allocate(0);
+            swap(other);
+        }
+
+        hash_table &operator=(const hash_table &other)
+        {
+            if (this != &other)
+            {
+                hash_table tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        hash_table &operator=(hash_table &&other)
+        {
+            if (this != &other)
+            {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~hash_table()
+        {
+            _destroy_all();
+            _deallocate();
+        }
+
+        iterator begin() { return iterator(this, _next_full(_origin)); }
+        const_iterator begin() const { return const_iterator(this, _next_full(_origin)); }
+        iterator end() { return iterator(this, _origin); }
+        const_iterator end() const { return const_iterator(this, _origin); }
+
+        bool empty() const { return _size == 0; }
+        size_type size() const { return _size; }
+        size_type max_size() const { return _alloc.max_size() / 2; }
+        size_type bucket_count() const { return _capacity; }
+        float load_factor() const { return _capacity ? float(_size) / float(_capacity) : 0.0f; }
+        float max_load_factor() const { return 0.875f; }
+        hasher hash_function() const { return _hash; }
+        key_equal key_eq() const { return _eq; }
+        allocator_type get_allocator() const { return _alloc; }
+
+        void clear()
+        {
+            if (!_size)
+                return;
+            _destroy_all();
+            std::memset(_ctrl, static_cast<unsigned char>(hash_group::empty),
+                        _capacity + hash_group::width - 1);
+            _size = 0;
+            _origin = 0;
+        }
+
+        void swap(hash_table &other)
+        {
+            std::swap(_ctrl, other._ctrl);
+            std::swap(_slots, other._slots);
+            std::swap(_capacity, other._capacity);
+            std::swap(_size, other._size);
+            std::swap(_origin, other._origin);
+            std::swap(_hash, other._hash);
+            std::swap(_eq, other._eq);
+            std::swap(_alloc, other._alloc);
+            std::swap(ctrl_alloc, other.ctrl_alloc);
+        }
+
+        // Sizes the table for n entries in one step, so filling it up to n
+        // never rehashes.
+        void reserve(size_type n)
+        {
+            size_type capacity = _capacity_for(n);
+            if (capacity > _capacity)
+                _rehash(capacity);
+        }
+
+        void rehash(size_type n)
+        {
+            size_type capacity = _capacity_for(std::max(n, _size));
+            if (capacity != _capacity)
+                _rehash(capacity);
+        }
+
+        // Builds the value from args only when k is absent.
+        template <class... Args>
+        std::pair<iterator, bool> emplace_key(const key_type &k, Args &&...args)
+        {
+            size_type h = _hash_of(k);
+            size_type i = _find_index(k, h);
+            if (i != _capacity)
+                return std::pair<iterator, bool>(iterator(this, i), false);
+            if (_size + 1 > _max_load(_capacity))
+                _rehash(_capacity ? _capacity * 2 : min_capacity);
+            i = _insert_index(h);
+            _alloc.construct(_slots + i, std::forward<Args>(args)...);
+            _set_ctrl(i, _h2(h));
+            ++_size;
+            if (i == _origin)
+                _origin = _next_empty(i);
+            return std::pair<iterator, bool>(iterator(this, i), true);
+        }
+
+        // Reads the key straight off v, as rb_tree does, so a v that is not
+        // a value_type only has its key converted for the lookup and is
+        // built into a slot only when that key is new.
+        template <class V>
+        std::pair<iterator, bool> insert_unique(V &&v)
+        {
+            return emplace_key(KeyOfValue()(v), std::forward<V>(v));
+        }
+
+        template <class InputIt>
+        void insert_range_unique(InputIt first, InputIt last)
+        {
+            _reserve_for(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+            for (; first != last; ++first)
+                insert_unique(*first);
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> emplace_unique(Args &&...args)
+        {
+            value_type tmp(std::forward<Args>(args)...);
+            return emplace_key(_key(tmp), std::move(tmp));
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            size_type i = pos.index();
+            _erase_index(i);
+            return iterator(this, _full(i) ? i : _next_full(i));
+        }
+
+        // Shifting entries one erase at a time could reorder what follows
+        // the range, so the whole range is emptied first and each run after
+        // an emptied slot is then re-placed from its home slots. A re-placed
+        // entry lands between first and its old slot, never before first,
+        // so iterating on from the first full slot at or after first visits
+        // exactly the entries that followed the range.
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            if (first == last)
+                return iterator(this, last.index());
+            if (first == begin() && last == end())
+            {
+                clear();
+                return end();
+            }
+            size_type stop = last.index();
+            for (size_type i = first.index(); i != stop; i = _next_full(i))
+            {
+                _alloc.destroy(_slots + i);
+                _set_ctrl(i, hash_group::doomed);
+                --_size;
+            }
+            size_type mask = _mask();
+            for (size_type d = first.index(); d != stop; d = (d + 1) & mask)
+            {
+                if (_ctrl[d] != hash_group::doomed)
+                    continue;
+                _set_ctrl(d, hash_group::empty);
+                for (size_type j = (d + 1) & mask; _full(j); j = (j + 1) & mask)
+                {
+                    size_type h = _hash_of(_key(_slots[j]));
+                    signed char h2 = _ctrl[j];
+                    _set_ctrl(j, hash_group::empty);
+                    size_type i = _insert_index(h);
+                    if (i != j)
+                    {
+                        _alloc.construct(_slots + i, std::move(_slots[j]));
+                        _alloc.destroy(_slots + j);
+                    }
+                    _set_ctrl(i, h2);
+                }
+            }
+            size_type i = first.index();
+            return iterator(this, _full(i) ? i : _next_full(i));
+        }
+
+        template <class K>
+        size_type erase_key(const K &k)
+        {
+            size_type i = _find_index(k, _hash_of(k));
+            if (i == _capacity)
+                return 0;
+            _erase_index(i);
+            return 1;
+        }
+
+        template <class K>
+        iterator find(const K &k)
+        {
+            size_type i = _find_index(k, _hash_of(k));
+            return i == _capacity ? end() : iterator(this, i);
+        }
+
+        template <class K>
+        const_iterator find(const K &k) const
+        {
+            size_type i = _find_index(k, _hash_of(k));
+            return i == _capacity ? end() : const_iterator(this, i);
+        }
+
+        template <class K>
+        size_type count(const K &k) const
+        {
+            return _find_index(k, _hash_of(k)) == _capacity ? 0 : 1;
+        }
+
+    private:
+        template <class InputIt>
+        void _reserve_for(InputIt, InputIt, std::input_iterator_tag) {}
+
+        template <class ForwardIt>
+        void _reserve_for(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+        {
+            reserve(_size + std::distance(first, last));
+        }
+    };
+
+    template <class Key, class Value, class KeyOfValue, class Hash, class KeyEqual, class Alloc>
+    const typename hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Alloc>::size_type
+        hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Alloc>::min_capacity;
+
+    // Equal when both hold the same entries, whatever their slots.
+    template <class KeyOfValue, class Container>
+    bool hash_equal(const Container &lhs, const Container &rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        for (typename Container::const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+        {
+            typename Container::const_iterator found = rhs.find(KeyOfValue()(*it));
+            if (found == rhs.end() || !(*found == *it))
+                return false;
+        }
+        return true;
+    }
+
+}
@@ -0,0 +1,482 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace ft
+{
+
+    // Embedded links for intrusive_list. An unlinked hook points at itself,
+    // so an object can tell whether it currently sits in a list. Copying an
+    // object never copies its links.
+    struct list_hook
+    {
+        list_hook *next;
+        list_hook *prev;
+
+        list_hook() : next(this), prev(this) {}
+        list_hook(const list_hook &) : next(this), prev(this) {}
+        list_hook &operator=(const list_hook &) { return *this; }
+
+        bool is_linked() const { return next != this; }
+        void unlink_hook() { next = prev = this; }
+    };
+
+    // A doubly linked list of objects that carry their own list_hook member.
+    // The list never allocates, copies or destroys elements: it only links
+    // and unlinks them, so the same object can sit in several lists through
+    // several hooks. Elements must outlive their membership. The list is
+    // circular around a sentinel hook, which end() points at, so --end()
+    // reaches the last element.
+    template <typename T, list_hook T::*Hook>
+    class intrusive_list
+    {
+    public:
+        typedef T value_type;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+
+    private:
+        list_hook _end;
+        size_type _size;
+
+        intrusive_list(const intrusive_list &);
+        intrusive_list &operator=(const intrusive_list &);
+
+        // Distance from a T to its Hook, read off the elements as they are
+        // linked: every hook to_value sees went through to_hook first. It is
+        // only stored when it changes, so lists on several threads share the
+        // cache line read-only.
+        static std::atomic<std::ptrdiff_t> hook_offset;
+
+        static T *to_value(list_hook *hook)
+        {
+            return reinterpret_cast<T *>(reinterpret_cast<char *>(hook) -
+                                         hook_offset.load(std::memory_order_relaxed));
+        }
+
+        static list_hook *to_hook(T &value)
+        {
+            list_hook *hook = &(value.*Hook);
+            std::ptrdiff_t offset = reinterpret_cast<char *>(hook) - reinterpret_cast<char *>(&value);
+            if (hook_offset.load(std::memory_order_relaxed) != offset)
+                hook_offset.store(offset, std::memory_order_relaxed);
+            return hook;
+        }
+
+        void link_before(list_hook *pos, list_hook *node)
+        {
+            node->prev = pos->prev;
+            node->next = pos;
+            pos->prev->next = node;
+            pos->prev = node;
+            ++_size;
+        }
+
+        list_hook *unlink(list_hook *node)
+        {
+            list_hook *next_node = node->next;
+            node->prev->next = next_node;
+            next_node->prev = node->prev;
+            node->unlink_hook();
+            --_size;
+            return next_node;
+        }
+
+        // Moves [first, last) in front of pos, which must lie outside it.
+        static void transfer(list_hook *pos, list_hook *first, list_hook *last)
+        {
+            list_hook *last_in = last->prev;
+            first->prev->next = last;
+            last->prev = first->prev;
+            first->prev = pos->prev;
+            last_in->next = pos;
+            pos->prev->next = first;
+            pos->prev = last_in;
+        }
+
+        // Moves every element of other into this list, which must be empty.
+        void take_all(intrusive_list &other)
+        {
+            if (other.empty())
+                return;
+            transfer(&_end, other._end.next, &other._end);
+            _size = other._size;
+            other._size = 0;
+        }
+
+    public:
+        class iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef T *pointer;
+            typedef T &reference;
+
+            iterator() : _node(nullptr) {}
+            explicit iterator(list_hook *n) : _node(n) {}
+
+            reference operator*() const { return *to_value(_node); }
+            pointer operator->() const { return to_value(_node); }
+
+            iterator &operator++()
+            {
+                _node = _node->next;
+                return *this;
+            }
+            iterator operator++(int)
+            {
+                iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+            iterator &operator--()
+            {
+                _node = _node->prev;
+                return *this;
+            }
+            iterator operator--(int)
+            {
+                iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const iterator &other) const
+            {
+                return _node == other._node;
+            }
+            bool operator!=(const iterator &other) const
+            {
+                return _node != other._node;
+            }
+
+            list_hook *base() const { return _node; }
+
+        private:
+            list_hook *_node;
+        };
+
+        class const_iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T *pointer;
+            typedef const T &reference;
+
+            const_iterator() : _node(nullptr) {}
+            explicit const_iterator(list_hook *n) : _node(n) {}
+            const_iterator(const iterator &other) : _node(other.base()) {}
+
+            reference operator*() const { return *to_value(_node); }
+            pointer operator->() const { return to_value(_node); }
+
+            const_iterator &operator++()
+            {
+                _node = _node->next;
+                return *this;
+            }
+            const_iterator operator++(int)
+            {
+                const_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+            const_iterator &operator--()
+            {
+                _node = _node->prev;
+                return *this;
+            }
+            const_iterator operator--(int)
+            {
+                const_iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const const_iterator &other) const
+            {
+                return _node == other._node;
+            }
+            bool operator!=(const const_iterator &other) const
+            {
+                return _node != other._node;
+            }
+
+            list_hook *base() const { return _node; }
+
+        private:
+            list_hook *_node;
+        };
+
+        intrusive_list() : _size(0) {}
+
+        intrusive_list(intrusive_list &&other) : _size(0)
+        {
+            take_all(other);
+        }
+
+        ~intrusive_list()
+        {
+            clear();
+        }
+
+        iterator begin() { return iterator(_end.next); }
+        const_iterator begin() const { return const_iterator(_end.next); }
+        iterator end() { return iterator(&_end); }
+        const_iterator end() const { return const_iterator(const_cast<list_hook *>(&_end)); }
+
+        // The iterator of an element already linked into this list.
+        iterator iterator_to(reference value) { return iterator(to_hook(value)); }
+
+        size_type size() const { return _size; }
+        bool empty() const { return _size == 0; }
+
+        reference front()
+        {
+            if (empty())
+                throw std::out_of_range("intrusive_list is empty");
+            return *to_value(_end.next);
+        }
+        const_reference front() const
+        {
+            if (empty())
+                throw std::out_of_range("intrusive_list is empty");
+            return *to_value(_end.next);
+        }
+        reference back()
+        {
+            if (empty())
+                throw std::out_of_range("intrusive_list is empty");
+            return *to_value(_end.prev);
+        }
+        const_reference back() const
+        {
+            if (empty())
+                throw std::out_of_range("intrusive_list is empty");
+            return *to_value(_end.prev);
+        }
+
+        void push_back(reference value) { link_before(&_end, to_hook(value)); }
+        void push_front(reference value) { link_before(_end.next, to_hook(value)); }
+
+        void pop_back()
+        {
+            if (empty())
+                throw std::out_of_range("intrusive_list is empty");
+            unlink(_end.prev);
+        }
+        void pop_front()
+        {
+            if (empty())
+                throw std::out_of_range("intrusive_list is empty");
+            unlink(_end.next);
+        }
+
+        iterator insert(iterator position, reference value)
+        {
+            list_hook *node = to_hook(value);
+            link_before(position.base(), node);
+            return iterator(node);
+        }
+
+        iterator erase(iterator position)
+        {
+            if (position.base() == &_end)
+                return end();
+            return iterator(unlink(position.base()));
+        }
+
+        iterator erase(iterator first, iterator last)
+        {
+            while (first != last)
+                first = erase(first);
+            return last;
+        }
+
+        // Unlinks every element; the elements themselves are left untouched.
+        void clear()
+        {
+            list_hook *node = _end.next;
+            while (node != &_end)
+            {
+                list_hook *next = node->next;
+                node->unlink_hook();
+                node = next;
+            }
+            _end.unlink_hook();
+            _size = 0;
+        }
+
+        // The sentinels stay put; the chains hanging off them trade places.
+        void swap(intrusive_list &other)
+        {
+            intrusive_list tmp;
+            tmp.take_all(other);
+            other.take_all(*this);
+            take_all(tmp);
+        }
+
+        void splice(iterator pos, intrusive_list &other)
+        {
+            if (other.empty())
+                return;
+            transfer(pos.base(), other._end.next, &other._end);
+            _size += other._size;
+            other._size = 0;
+        }
+
+        void splice(iterator pos, intrusive_list &other, iterator it)
+        {
+            list_hook *node = it.base();
+            if (node == &other._end || node == pos.base())
+                return;
+            other.unlink(node);
+            link_before(pos.base(), node);
+        }
+
+        void splice(iterator pos, intrusive_list &other, iterator first, iterator last)
+        {
+            if (first == last)
+                return;
+            size_type count = std::distance(first, last);
+            transfer(pos.base(), first.base(), last.base());
+            other._size -= count;
+            _size += count;
+        }
+
+        void remove(const_reference value)
+        {
+            remove_if([&value](const_reference x)
+                      { return x == value; });
+        }
+
+        template <class Predicate>
+        void remove_if(Predicate pred)
+        {
+            iterator it = begin();
+            while (it != end())
+            {
+                if (pred(*it))
+                    it = erase(it);
+                else
+                    ++it;
+            }
+        }
+
+        void unique()
+        {
+            unique([](const_reference a, const_reference b)
+                   { return a == b; });
+        }
+
+        template <class BinaryPredicate>
+        void unique(BinaryPredicate pred)
+        {
+            if (empty())
+                return;
+            iterator first = begin();
+            iterator next = first;
+            ++next;
+            while (next != end())
+            {
+                if (pred(*first, *next))
+                    next = erase(next);
+                else
+                {
+                    first = next;
+                    ++next;
+                }
+            }
+        }
+
+        void merge(intrusive_list &other)
+        {
+            merge(other, [](const_reference a, const_reference b)
+                  { return a < b; });
+        }
+
+        template <class Compare>
+        void merge(intrusive_list &other, Compare comp)
+        {
+            if (this == &other)
+                return;
+            iterator it1 = begin();
+            iterator it2 = other.begin();
+            while (it1 != end() && it2 != other.end())
+            {
+                if (comp(*it2, *it1))
+                {
+                    iterator next = it2;
+                    ++next;
+                    splice(it1, other, it2);
+                    it2 = next;
+                }
+                else
+                    ++it1;
+            }
+            if (it2 != other.end())
+                splice(end(), other, it2, other.end());
+        }
+
+        void sort()
+        {
+            sort([](const_reference a, const_reference b)
+                 { return a < b; });
+        }
+
+        template <class Compare>
+        void sort(Compare comp)
+        {
+            if (_size < 2)
+                return;
+
+            intrusive_list carry;
+            intrusive_list counter[64];
+            int fill = 0;
+            while (!empty())
+            {
+                carry.splice(carry.begin(), *this, begin());
+                int i = 0;
+                while (i < fill && !counter[i].empty())
+                {
+                    counter[i].merge(carry, comp);
+                    carry.swap(counter[i]);
+                    ++i;
+                }
+                carry.swap(counter[i]);
+                if (i == fill)
+                    ++fill;
+            }
+
+            for (int i = 1; i < fill; ++i)
+                counter[i].merge(counter[i - 1], comp);
+            swap(counter[fill - 1]);
+        }
+
+        void reverse()
+        {
+            list_hook *node = &_end;
+            do
+            {
+                std::swap(node->next, node->prev);
+                node = node->prev;
+            } while (node != &_end);
+        }
+    };
+
+    template <typename T, list_hook T::*Hook>
+    std::atomic<std::ptrdiff_t> intrusive_list<T, Hook>::hook_offset(0);
+
+}
@@ -5,14 +5,21 @@
 #include <stdexcept>
 #include <iterator>
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <type_traits>
 #include <utility>
+#include <thread>
+
+#include "pool_allocator.hpp"
 
 namespace ft
 {
 
+    // Circular doubly linked list around a sentinel: end() is the sentinel,
+    // so --end() is the last element and no operation has to special-case
+    // an empty list, the head or the tail.
     template <typename T, class Alloc = std::allocator<T>>
     class list
     {
@@ -27,21 +34,271 @@ namespace ft
         typedef typename Alloc::const_pointer const_pointer;
 
     private:
-        struct Node
+        struct NodeBase
+        {
+            NodeBase *next;
+            NodeBase *prev;
+        };
+        // Keeps the forwarding constructor from hijacking Node's copy.
+        struct construct_tag
+        {
+        };
+        struct Node : NodeBase
         {
             value_type data;
-            Node *next;
-            Node *prev;
-            Node(const value_type &val) : data(val), next(nullptr), prev(nullptr) {}
-            Node() : data(value_type()), next(nullptr), prev(nullptr) {}
+
+            template <class... Args>
+            Node(construct_tag, Args &&...args)
+                : NodeBase(), data(std::forward<Args>(args)...) {}
         };
-        Node *head;
-        Node *tail;
+        NodeBase _end;
         size_type _size;
         allocator_type _alloc;
         typedef typename Alloc::template rebind<Node>::other node_allocator;
         node_allocator node_alloc;
 
+        static value_type &_value(NodeBase *node)
+        {
+            return static_cast<Node *>(node)->data;
+        }
+
+        void _init_empty()
+        {
+            _end.next = _end.prev = &_end;
+            _size = 0;
+        }
+
+        template <class... Args>
+        Node *_create_node(Args &&...args)
+        {
+            Node *node = node_alloc.allocate(1);
+            try
+            {
+                node_alloc.construct(node, construct_tag(), std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                node_alloc.deallocate(node, 1);
+                throw;
+            }
+            return node;
+        }
+
+        void _destroy_node(NodeBase *node)
+        {
+            node_alloc.destroy(static_cast<Node *>(node));
+            node_alloc.deallocate(static_cast<Node *>(node), 1);
+        }
+
+        static void _hook(NodeBase *pos, NodeBase *node)
+        {
+            node->next = pos;
+            node->prev = pos->prev;
+            pos->prev->next = node;
+            pos->prev = node;
+        }
+
+        static void _unhook(NodeBase *node)
+        {
+            node->prev->next = node->next;
+            node->next->prev = node->prev;
+        }
+
+        // Moves [first, last) in front of pos, which must lie outside it.
+        static void _transfer(NodeBase *pos, NodeBase *first, NodeBase *last)
+        {
+            NodeBase *last_in = last->prev;
+            first->prev->next = last;
+            last->prev = first->prev;
+            first->prev = pos->prev;
+            last_in->next = pos;
+            pos->prev->next = first;
+            pos->prev = last_in;
+        }
+
+        // Relinking nodes is only safe between lists drawing from one pool:
+        // a list that is the sole owner of its pool frees every slab at once
+        // in clear(), under nodes another list may have taken. Across pools
+        // the nodes of other in [first, last) are replaced by nodes from our
+        // allocator holding the same values. Returns the new first node.
+        // Every node is allocated before a value leaves other, and values
+        // are only moved when that cannot throw, so on failure other keeps
+        // all of them; move-only values with a throwing move may be lost.
+        NodeBase *_adopt(list &other, NodeBase *first, NodeBase *last)
+        {
+            if (first == last || node_alloc == other.node_alloc)
+                return first;
+            size_type n = 0;
+            for (NodeBase *node = first; node != last; node = node->next)
+                ++n;
+            std::unique_ptr<Node *[]> nodes(new Node *[n]);
+            size_type allocated = 0, built = 0;
+            try
+            {
+                for (; allocated < n; ++allocated)
+                    nodes[allocated] = node_alloc.allocate(1);
+                for (NodeBase *node = first; built < n; ++built, node = node->next)
+                    node_alloc.construct(nodes[built], construct_tag(), std::move_if_noexcept(_value(node)));
+            }
+            catch (...)
+            {
+                for (size_type i = 0; i < allocated; ++i)
+                {
+                    if (i < built)
+                        node_alloc.destroy(nodes[i]);
+                    node_alloc.deallocate(nodes[i], 1);
+                }
+                throw;
+            }
+            NodeBase *before = first->prev;
+            while (first != last)
+            {
+                NodeBase *next = first->next;
+                other._destroy_node(first);
+                first = next;
+            }
+            before->next = last;
+            last->prev = before;
+            for (size_type i = 0; i < n; ++i)
+                _hook(last, nodes[i]);
+            return before->next;
+        }
+
+        // Points sentinel at itself if the list it heads is empty, otherwise
+        // makes the first and last nodes point back at it.
+        static void _fix_sentinel(NodeBase &sentinel, NodeBase &old)
+        {
+            if (sentinel.next == &old)
+                sentinel.next = sentinel.prev = &sentinel;
+            else
+            {
+                sentinel.next->prev = &sentinel;
+                sentinel.prev->next = &sentinel;
+            }
+        }
+
+        // Cuts the elements off the sentinel as a null-terminated chain.
+        void _detach_chain(NodeBase *&first, NodeBase *&last)
+        {
+            first = _end.next;
+            last = _end.prev;
+            first->prev = nullptr;
+            last->next = nullptr;
+        }
+
+        void _attach_chain(NodeBase *first, NodeBase *last)
+        {
+            _end.next = first;
+            first->prev = &_end;
+            _end.prev = last;
+            last->next = &_end;
+        }
+
+        // Merges two null-terminated chains whose prev links are already
+        // valid inside each chain, taking from a on ties so the result is
+        // stable. Returns the merged head and stores its last node in last.
+        template <class Compare>
+        static NodeBase *_merge_links(NodeBase *a, NodeBase *a_last, NodeBase *b, NodeBase *b_last,
+                                      Compare &comp, NodeBase *&last)
+        {
+            NodeBase *first = nullptr;
+            NodeBase *prev = nullptr;
+            NodeBase **link = &first;
+            while (a && b)
+            {
+                NodeBase *pick;
+                if (comp(_value(b), _value(a)))
+                {
+                    pick = b;
+                    b = b->next;
+                }
+                else
+                {
+                    pick = a;
+                    a = a->next;
+                }
+                pick->prev = prev;
+                prev = pick;
+                *link = pick;
+                link = &pick->next;
+            }
+            *link = a ? a : b;
+            (*link)->prev = prev;
+            last = a ? a_last : b_last;
+            return first;
+        }
+
+        static const size_type _parallel_sort_min_chunk = 4096;
+
+        // Bottom-up natural merge sort of the chain [first, last]: ascending
+        // runs are taken as they are, strictly descending ones are reversed
+        // in place, and runs are merged through binary-counter buckets.
+        // Stable. Leaves first/last pointing at the sorted chain's ends.
+        template <class Compare>
+        static void _sort_links(NodeBase *&first, NodeBase *&last_node, Compare &comp)
+        {
+            NodeBase *counter[64] = {};
+            NodeBase *counter_last[64] = {};
+            int fill = 0;
+            NodeBase *rest = first;
+            while (rest)
+            {
+                NodeBase *run = rest;
+                NodeBase *last = rest;
+                rest = rest->next;
+                if (rest && comp(_value(rest), _value(run)))
+                {
+                    while (rest && comp(_value(rest), _value(run)))
+                    {
+                        NodeBase *next = rest->next;
+                        rest->next = run;
+                        run->prev = rest;
+                        run = rest;
+                        rest = next;
+                    }
+                }
+                else
+                {
+                    while (rest && !comp(_value(rest), _value(last)))
+                    {
+                        last = rest;
+                        rest = rest->next;
+                    }
+                }
+                last->next = nullptr;
+
+                int i = 0;
+                while (i < fill && counter[i])
+                {
+                    run = _merge_links(counter[i], counter_last[i], run, last, comp, last);
+                    counter[i] = nullptr;
+                    ++i;
+                }
+                counter[i] = run;
+                counter_last[i] = last;
+                if (i == fill)
+                    ++fill;
+            }
+
+            NodeBase *sorted = nullptr;
+            NodeBase *sorted_last = nullptr;
+            for (int i = 0; i < fill; ++i)
+            {
+                if (!counter[i])
+                    continue;
+                if (sorted)
+                    sorted = _merge_links(counter[i], counter_last[i], sorted, sorted_last,
+                                          comp, sorted_last);
+                else
+                {
+                    sorted = counter[i];
+                    sorted_last = counter_last[i];
+                }
+            }
+            first = sorted;
+            last_node = sorted_last;
+        }
+
     public:
         class iterator
         {
@@ -53,7 +310,7 @@ namespace ft
             typedef T &reference;
 
             iterator() : _node(nullptr) {}
-            explicit iterator(Node *n) : _node(n) {}
+            explicit iterator(NodeBase *n) : _node(n) {}
             iterator(const iterator &other) : _node(other._node) {}
 
             iterator &operator=(const iterator &other)
@@ -62,13 +319,12 @@ namespace ft
                 return *this;
             }
 
-            reference operator*() const { return _node->data; }
-            pointer operator->() const { return &_node->data; }
+            reference operator*() const { return _value(_node); }
+            pointer operator->() const { return &_value(_node); }
 
             iterator &operator++()
             {
-                if (_node)
-                    _node = _node->next;
+                _node = _node->next;
                 return *this;
             }
             iterator operator++(int)
@@ -79,8 +335,7 @@ namespace ft
             }
             iterator &operator--()
             {
-                if (_node)
-                    _node = _node->prev;
+                _node = _node->prev;
                 return *this;
             }
             iterator operator--(int)
@@ -99,10 +354,10 @@ namespace ft
                 return _node != other._node;
             }
 
-            Node *base() const { return _node; }
+            NodeBase *base() const { return _node; }
 
         private:
-            Node *_node;
+            NodeBase *_node;
         };
 
         class const_iterator
@@ -115,7 +370,7 @@ namespace ft
             typedef const T &reference;
 
             const_iterator() : _node(nullptr) {}
-            explicit const_iterator(Node *n) : _node(n) {}
+            explicit const_iterator(const NodeBase *n) : _node(const_cast<NodeBase *>(n)) {}
             const_iterator(const const_iterator &other) : _node(other._node) {}
             const_iterator(const iterator &other) : _node(other.base()) {}
 
@@ -125,13 +380,12 @@ namespace ft
                 return *this;
             }
 
-            reference operator*() const { return _node->data; }
-            pointer operator->() const { return &_node->data; }
+            reference operator*() const { return _value(_node); }
+            pointer operator->() const { return &_value(_node); }
 
             const_iterator &operator++()
             {
-                if (_node)
-                    _node = _node->next;
+                _node = _node->next;
                 return *this;
             }
             const_iterator operator++(int)
@@ -142,8 +396,7 @@ namespace ft
             }
             const_iterator &operator--()
             {
-                if (_node)
-                    _node = _node->prev;
+                _node = _node->prev;
                 return *this;
             }
             const_iterator operator--(int)
@@ -162,26 +415,60 @@ namespace ft
                 return _node != other._node;
             }
 
-            Node *base() const { return _node; }
-
-            typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
-            typedef std::reverse_iterator<iterator> reverse_iterator;
+            NodeBase *base() const { return _node; }
 
         private:
-            Node *_node;
+            NodeBase *_node;
         };
 
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
     public:
         explicit list(const allocator_type &alloc = allocator_type())
-            : head(nullptr), tail(nullptr), _size(0), _alloc(alloc), node_alloc() {}
+            : _size(0), _alloc(alloc), node_alloc(alloc)
+        {
+            _init_empty();
+        }
 
         explicit list(size_type n, const value_type &val = value_type(),
                       const allocator_type &alloc = allocator_type())
-            : head(nullptr), tail(nullptr), _size(0), _alloc(alloc), node_alloc()
+            : _size(0), _alloc(alloc), node_alloc(alloc)
+        {
+            _init_empty();
+            try
+            {
+                insert(end(), n, val);
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        list(const list &other)
+            : _size(0), _alloc(other._alloc), node_alloc(other._alloc)
+        {
+            _init_empty();
+            try
+            {
+                insert(end(), other.begin(), other.end());
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        list &operator=(const list &other)
         {
-            for (size_type i = 0; i < n; i++)
-                push_back(val);
+            if (this != &other)
+                assign(other.begin(), other.end());
+            return *this;
         }
+
         ~list()
         {
             clear();
@@ -189,46 +476,59 @@ namespace ft
 
         iterator begin()
         {
-            return iterator(head);
+            return iterator(_end.next);
         }
         const_iterator begin() const
         {
-            return const_iterator(head);
+            return const_iterator(_end.next);
         }
 
         iterator end()
         {
-            return iterator(nullptr);
+            return iterator(&_end);
         }
         const_iterator end() const
         {
-            return const_iterator(nullptr);
+            return const_iterator(&_end);
         }
 
-        iterator rbegin()
+        reverse_iterator rbegin()
         {
-            return iterator(tail);
+            return reverse_iterator(end());
         }
-        const_iterator rbegin() const
+        const_reverse_iterator rbegin() const
         {
-            return const_iterator(tail);
+            return const_reverse_iterator(end());
         }
 
-        iterator rend()
+        reverse_iterator rend()
         {
-            return iterator(nullptr);
+            return reverse_iterator(begin());
         }
-        const_iterator rend() const
+        const_reverse_iterator rend() const
         {
-            return const_iterator(nullptr);
+            return const_reverse_iterator(begin());
         }
 
         void clear()
         {
-            while (!empty())
+            bool bulk = pool_traits<node_allocator>::owns_pool(node_alloc);
+            if (!bulk || !std::is_trivially_destructible<value_type>::value)
             {
-                pop_back();
+                NodeBase *node = _end.next;
+                while (node != &_end)
+                {
+                    NodeBase *next = node->next;
+                    if (bulk)
+                        node_alloc.destroy(static_cast<Node *>(node));
+                    else
+                        _destroy_node(node);
+                    node = next;
+                }
             }
+            if (bulk)
+                pool_traits<node_allocator>::release(node_alloc);
+            _init_empty();
         }
 
         size_type size() const
@@ -248,32 +548,31 @@ namespace ft
         {
             if (empty())
                 throw std::out_of_range("list is empty");
-            return head->data;
+            return _value(_end.next);
         }
         const_reference front() const
         {
             if (empty())
                 throw std::out_of_range("list is empty");
-            return head->data;
+            return _value(_end.next);
         }
         reference back()
         {
             if (empty())
                 throw std::out_of_range("list is empty");
-            return tail->data;
+            return _value(_end.prev);
         }
         const_reference back() const
         {
             if (empty())
                 throw std::out_of_range("list is empty");
-            return tail->data;
+            return _value(_end.prev);
         }
 
         void assign(size_type n, const value_type &val)
         {
             clear();
-            for (size_type i = 0; i < n; i++)
-                push_back(val);
+            insert(end(), n, val);
         }
 
         template <typename InputIterator>
@@ -281,15 +580,13 @@ namespace ft
         assign(InputIterator first, InputIterator last)
         {
             clear();
-            for (InputIterator it = first; it != last; ++it)
-                push_back(*it);
+            insert(end(), first, last);
         }
 
         void assign(std::initializer_list<value_type> il)
         {
             clear();
-            for (const value_type &val : il)
-                push_back(val);
+            insert(end(), il.begin(), il.end());
         }
 
         template <typename InputIterator>
@@ -299,80 +596,19 @@ namespace ft
             InputIterator first,
             InputIterator last)
         {
-            if (first == last)
-                return;
-
-            Node *next_node = position.base();
-            Node *prev_node = next_node ? next_node->prev : tail;
-            Node *first_new = nullptr;
-            Node *last_new = nullptr;
-
-            for (InputIterator it = first; it != last; ++it)
+            for (; first != last; ++first)
             {
-                Node *node = node_alloc.allocate(1);
-                node_alloc.construct(node, Node(*it));
-                node->prev = prev_node;
-                node->next = nullptr;
-                if (prev_node)
-                    prev_node->next = node;
-                else
-                    first_new = node;
-                prev_node = node;
-                if (!first_new)
-                    first_new = node;
-                last_new = node;
+                _hook(position.base(), _create_node(*first));
                 ++_size;
             }
-
-            if (next_node)
-            {
-                last_new->next = next_node;
-                next_node->prev = last_new;
-            }
-            else
-            {
-                tail = last_new;
-            }
-
-            if (!head)
-                head = first_new;
         }
 
-        void insert(iterator position, const value_type &val)
+        iterator insert(iterator position, const value_type &val)
         {
-            Node *node = node_alloc.allocate(1);
-            node_alloc.construct(node, Node(val));
-
-            if (empty())
-            {
-                head = tail = node;
-                node->prev = node->next = nullptr;
-            }
-            else if (position.base() == head)
-            {
-                node->next = head;
-                node->prev = nullptr;
-                head->prev = node;
-                head = node;
-            }
-            else if (position.base() == nullptr)
-            {
-                node->prev = tail;
-                node->next = nullptr;
-                tail->next = node;
-                tail = node;
-            }
-            else
-            {
-                Node *next_node = position.base();
-                Node *prev_node = next_node->prev;
-                node->prev = prev_node;
-                node->next = next_node;
-                prev_node->next = node;
-                next_node->prev = node;
-            }
-
+            Node *node = _create_node(val);
+            _hook(position.base(), node);
             ++_size;
+            return iterator(node);
         }
 
         void insert(
@@ -380,83 +616,48 @@ namespace ft
             size_type n,
             const value_type &value)
         {
-            if (n == 0)
-                return;
-
-            Node *next_node = position.base();
-            Node *prev_node = next_node ? next_node->prev : tail;
-
             for (size_type i = 0; i < n; ++i)
             {
-                Node *node = node_alloc.allocate(1);
-                node_alloc.construct(node, Node(value));
-                node->prev = prev_node;
-                node->next = nullptr;
-
-                if (prev_node)
-                    prev_node->next = node;
-                else
-                    head = node;
-
-                prev_node = node;
-            }
-
-            if (next_node)
-            {
-                prev_node->next = next_node;
-                next_node->prev = prev_node;
-            }
-            else
-            {
-                tail = prev_node;
+                _hook(position.base(), _create_node(value));
+                ++_size;
             }
-
-            _size += n;
         }
 
-        void emplace_front(const value_type &val)
+        template <class... Args>
+        void emplace_front(Args &&...args)
         {
-            push_front(val);
+            _hook(_end.next, _create_node(std::forward<Args>(args)...));
+            _size++;
         }
 
-        void emplace_back(const value_type &val)
+        template <class... Args>
+        void emplace_back(Args &&...args)
         {
-            push_back(val);
+            _hook(&_end, _create_node(std::forward<Args>(args)...));
+            _size++;
         }
 
         void push_back(const value_type &val)
         {
-            Node *new_node = node_alloc.allocate(1);
-            node_alloc.construct(new_node, Node(val));
-            if (empty())
-            {
-                head = new_node;
-                tail = new_node;
-            }
-            else
-            {
-                tail->next = new_node;
-                new_node->prev = tail;
-                tail = new_node;
-            }
+            _hook(&_end, _create_node(val));
+            _size++;
+        }
+
+        void push_back(value_type &&val)
+        {
+            _hook(&_end, _create_node(std::move(val)));
             _size++;
         }
 
         void push_front(const value_type &val)
         {
-            Node *new_node = node_alloc.allocate(1);
-            node_alloc.construct(new_node, Node(val));
-            if (empty())
-            {
-                head = new_node;
-                tail = new_node;
-            }
-            else
-            {
-                new_node->next = head;
-                head->prev = new_node;
-                head = new_node;
-            }
+            _hook(_end.next, _create_node(val));
+            _size++;
+        }
+
+        void push_front(value_type &&val)
+        {
+            _hook(_end.next, _create_node(std::move(val)));
             _size++;
         }
 
@@ -464,40 +665,14 @@ namespace ft
         {
             if (empty())
                 throw std::out_of_range("list is empty");
-            Node *to_delete = tail;
-            if (head == tail)
-            {
-                head = nullptr;
-                tail = nullptr;
-            }
-            else
-            {
-                tail = tail->prev;
-                tail->next = nullptr;
-            }
-            node_alloc.destroy(to_delete);
-            node_alloc.deallocate(to_delete, 1);
-            _size--;
+            erase(iterator(_end.prev));
         }
 
         void pop_front()
         {
             if (empty())
                 throw std::out_of_range("list is empty");
-            Node *to_delete = head;
-            if (head == tail)
-            {
-                head = nullptr;
-                tail = nullptr;
-            }
-            else
-            {
-                head = head->next;
-                head->prev = nullptr;
-            }
-            node_alloc.destroy(to_delete);
-            node_alloc.deallocate(to_delete, 1);
-            _size--;
+            erase(iterator(_end.next));
         }
 
         void emplace(
@@ -509,22 +684,10 @@ namespace ft
 
         iterator erase(iterator position)
         {
-            Node *node = position.base();
-            if (!node)
-                return end();
-
-            Node *prev_node = node->prev;
-            Node *next_node = node->next;
-            if (prev_node)
-                prev_node->next = next_node;
-            else
-                head = next_node;
-            if (next_node)
-                next_node->prev = prev_node;
-            else
-                tail = prev_node;
-            node_alloc.destroy(node);
-            node_alloc.deallocate(node, 1);
+            NodeBase *node = position.base();
+            NodeBase *next_node = node->next;
+            _unhook(node);
+            _destroy_node(node);
             --_size;
             return iterator(next_node);
         }
@@ -540,96 +703,47 @@ namespace ft
 
         void swap(list &other)
         {
-            Node *tmp_head = head;
-            head = other.head;
-            other.head = tmp_head;
-            Node *tmp_tail = tail;
-            tail = other.tail;
-            other.tail = tmp_tail;
-            size_t tmp_size = _size;
-            _size = other._size;
-            other._size = tmp_size;
+            std::swap(_end, other._end);
+            _fix_sentinel(_end, other._end);
+            _fix_sentinel(other._end, _end);
+            std::swap(_size, other._size);
+            std::swap(_alloc, other._alloc);
             std::swap(node_alloc, other.node_alloc);
         }
 
         void resize(size_t new_size, const T &value = T())
         {
-            if (new_size < _size)
-                while (_size > new_size)
-                    erase(--end());
-            else if (new_size > _size)
-                while (_size < new_size)
-                    push_back(value);
+            while (_size > new_size)
+                pop_back();
+            if (new_size > _size)
+                insert(end(), new_size - _size, value);
         }
 
+        // The allocator the nodes actually come from, so two lists compare
+        // equal only when they share a pool.
         allocator_type get_allocator() const
         {
-            return _alloc;
+            return allocator_type(node_alloc);
         }
 
         void splice(iterator pos, list &other)
         {
             if (other.empty())
                 return;
-
-            Node *before = pos.base() ? pos.base()->prev : tail;
-            if (before)
-            {
-                before->next = other.head;
-                other.head->prev = before;
-            }
-            else
-            {
-                head = other.head;
-            }
-
-            if (pos.base())
-            {
-                pos.base()->prev = other.tail;
-                other.tail->next = pos.base();
-            }
-            else
-            {
-                tail = other.tail;
-            }
-
+            _adopt(other, other._end.next, &other._end);
+            _transfer(pos.base(), other._end.next, &other._end);
             _size += other._size;
-            other.head = other.tail = 0;
             other._size = 0;
         }
 
         void splice(iterator pos, list &other, iterator it)
         {
-            Node *node = it.base();
-            if (!node)
+            NodeBase *node = it.base();
+            if (node == pos.base())
                 return;
-            if (node->prev)
-                node->prev->next = node->next;
-            else
-                other.head = node->next;
-
-            if (node->next)
-                node->next->prev = node->prev;
-            else
-                other.tail = node->prev;
-
+            node = _adopt(other, node, node->next);
+            _transfer(pos.base(), node, node->next);
             --other._size;
-
-            Node *before = pos.base() ? pos.base()->prev : tail;
-
-            node->prev = before;
-            node->next = pos.base();
-
-            if (before)
-                before->next = node;
-            else
-                head = node;
-
-            if (pos.base())
-                pos.base()->prev = node;
-            else
-                tail = node;
-
             ++_size;
         }
 
@@ -637,42 +751,14 @@ namespace ft
         {
             if (first == last)
                 return;
-            Node *first_node = first.base();
-            Node *last_node = last.base() ? last.base()->prev : other.tail;
-
-            Node *before_first = first_node->prev;
-            Node *after_last = last_node->next;
-
-            if (before_first)
-                before_first->next = after_last;
-            else
-                other.head = after_last;
-
-            if (after_last)
-                after_last->prev = before_first;
-            else
-                other.tail = before_first;
-            size_t count = 0;
-            for (Node *n = first_node; n != after_last; n = n->next)
-                ++count;
-
-            other._size -= count;
-            Node *before = pos.base() ? pos.base()->prev : tail;
-
-            first_node->prev = before;
-            last_node->next = pos.base();
-
-            if (before)
-                before->next = first_node;
-            else
-                head = first_node;
-
-            if (pos.base())
-                pos.base()->prev = last_node;
-            else
-                tail = last_node;
-
-            _size += count;
+            first = iterator(_adopt(other, first.base(), last.base()));
+            if (this != &other)
+            {
+                size_type count = std::distance(first, last);
+                other._size -= count;
+                _size += count;
+            }
+            _transfer(pos.base(), first.base(), last.base());
         }
 
         void remove(const value_type &value)
@@ -741,130 +827,145 @@ namespace ft
         }
 
         void sort()
+        {
+            sort(std::less<value_type>());
+        }
+
+        template <class Compare>
+        void sort(Compare comp)
         {
             if (_size < 2)
                 return;
+            NodeBase *first;
+            NodeBase *last;
+            _detach_chain(first, last);
+            _sort_links(first, last, comp);
+            _attach_chain(first, last);
+        }
 
-            list carry;
-            list counter[64];
-            int fill = 0;
-            while (!empty())
+        void parallel_sort(unsigned threads = std::thread::hardware_concurrency())
+        {
+            parallel_sort(std::less<value_type>(), threads);
+        }
+
+        // Cuts the list into one chain per thread, sorts the chains
+        // concurrently and merges neighbouring pairs concurrently until one
+        // is left. Stable, like sort(). comp is copied into every worker and
+        // must not throw. Small lists fall back to sort().
+        template <class Compare>
+        typename std::enable_if<!std::is_integral<Compare>::value>::type
+        parallel_sort(Compare comp, unsigned threads = std::thread::hardware_concurrency())
+        {
+            size_type chunk_size = _size / (threads ? threads : 1);
+            if (threads < 2 || chunk_size < _parallel_sort_min_chunk)
             {
-                carry.splice(carry.begin(), *this, begin());
-                int i = 0;
-                while (i < fill && !counter[i].empty())
-                {
-                    counter[i].merge(carry);
-                    carry.swap(counter[i]);
-                    ++i;
-                }
-                carry.swap(counter[i]);
-                if (i == fill)
-                    ++fill;
+                sort(comp);
+                return;
+            }
+
+            std::unique_ptr<NodeBase *[]> first(new NodeBase *[threads]);
+            std::unique_ptr<NodeBase *[]> last(new NodeBase *[threads]);
+            NodeBase *node = _end.next;
+            for (unsigned c = 0; c < threads; ++c)
+            {
+                first[c] = node;
+                node->prev = nullptr;
+                size_type n = c + 1 < threads ? chunk_size : _size - chunk_size * c;
+                while (--n)
+                    node = node->next;
+                last[c] = node;
+                node = node->next;
+                last[c]->next = nullptr;
             }
 
-            for (int i = 1; i < fill; ++i)
+            std::unique_ptr<std::thread[]> workers(new std::thread[threads]);
+            for (unsigned c = 0; c < threads; ++c)
+                workers[c] = std::thread([&first, &last, c, comp]() mutable
+                                         { _sort_links(first[c], last[c], comp); });
+            for (unsigned c = 0; c < threads; ++c)
+                workers[c].join();
+
+            for (unsigned step = 1; step < threads; step *= 2)
             {
-                counter[i].merge(counter[i - 1]);
+                unsigned spawned = 0;
+                for (unsigned c = 0; c + step < threads; c += 2 * step)
+                    workers[spawned++] = std::thread([&first, &last, c, step, comp]() mutable
+                                                     { first[c] = _merge_links(first[c], last[c],
+                                                                               first[c + step], last[c + step],
+                                                                               comp, last[c]); });
+                for (unsigned w = 0; w < spawned; ++w)
+                    workers[w].join();
             }
-            swap(counter[fill - 1]);
+
+            _attach_chain(first[0], last[0]);
         }
 
+        void sort_buffered()
+        {
+            sort_buffered(std::less<value_type>());
+        }
+
+        // Gathers node pointers into one array, stable-sorts that and relinks
+        // the nodes in a single pass. Trades _size pointers of scratch space
+        // for sequential merges instead of chasing links.
         template <class Compare>
-        void sort(Compare comp)
+        void sort_buffered(Compare comp)
         {
             if (_size < 2)
                 return;
 
-            list carry;
-            list counter[64];
-            int fill = 0;
-
-            while (!empty())
-            {
-                carry.splice(carry.begin(), *this, begin());
-                int i = 0;
-                while (i < fill && !counter[i].empty())
-                {
-                    counter[i].merge(carry, comp);
-                    carry.swap(counter[i]);
-                    ++i;
-                }
-                carry.swap(counter[i]);
-                if (i == fill)
-                    ++fill;
-            }
+            std::unique_ptr<NodeBase *[]> nodes(new NodeBase *[_size]);
+            size_type n = 0;
+            for (NodeBase *node = _end.next; node != &_end; node = node->next)
+                nodes[n++] = node;
+            std::stable_sort(nodes.get(), nodes.get() + n,
+                             [&comp](NodeBase *a, NodeBase *b)
+                             { return comp(_value(a), _value(b)); });
 
-            for (int i = 1; i < fill; ++i)
+            NodeBase *prev = &_end;
+            for (size_type i = 0; i < n; ++i)
             {
-                counter[i].merge(counter[i - 1], comp);
+                nodes[i]->prev = prev;
+                prev->next = nodes[i];
+                prev = nodes[i];
             }
-            swap(counter[fill - 1]);
+            prev->next = &_end;
+            _end.prev = prev;
         }
 
         void merge(list &other)
         {
-            if (this == &other)
-                return;
-            iterator it1 = begin();
-            iterator it2 = other.begin();
-            while (it1 != end() && it2 != other.end())
-            {
-                if (*it2 < *it1)
-                {
-                    iterator next = it2;
-                    ++next;
-                    splice(it1, other, it2);
-                    it2 = next;
-                }
-                else
-                    ++it1;
-            }
-            if (it2 != other.end())
-                splice(end(), other, it2, other.end());
+            merge(other, std::less<value_type>());
         }
 
         void reverse()
         {
-            if (_size <= 1)
-                return;
-
-            Node *current = head;
-            Node *tmp = 0;
-
-            while (current)
+            NodeBase *node = &_end;
+            do
             {
-                tmp = current->prev;
-                current->prev = current->next;
-                current->next = tmp;
-                current = current->prev; 
-            }
-            tmp = head;
-            head = tail;
-            tail = tmp;
+                std::swap(node->next, node->prev);
+                node = node->prev;
+            } while (node != &_end);
         }
 
         template <class Compare>
         void merge(list &other, Compare comp)
         {
-            if (this == &other)
+            if (this == &other || other.empty())
                 return;
-            iterator it1 = begin();
-            iterator it2 = other.begin();
-            while (it1 != end() && it2 != other.end())
+            if (empty())
             {
-                if (comp(*it2, *it1))
-                {
-                    iterator next = it2;
-                    ++next;
-                    splice(it1, other, it2);
-                    it2 = next;
-                }
-                else
-                    ++it1;
+                splice(end(), other);
+                return;
             }
-            if (it2 != other.end())
-                splice(end(), other, it2, other.end());
+            _adopt(other, other._end.next, &other._end);
+            NodeBase *first, *last, *other_first, *other_last;
+            _detach_chain(first, last);
+            other._detach_chain(other_first, other_last);
+            first = _merge_links(first, last, other_first, other_last, comp, last);
+            _attach_chain(first, last);
+            _size += other._size;
+            other._init_empty();
         }
     };
 
@@ -1,13 +1,42 @@
 #include <iostream>
 #include <vector>
 #include "vector.hpp"
+#include "small_vector.hpp"
 #include <list>
 #include "list.hpp"
+#include "pool_allocator.hpp"
+#include "intrusive_list.hpp"
+#include "unrolled_list.hpp"
 #include "deque.hpp"
 #include <math.h>
 #include <algorithm>
 #include "deque.hpp"
 #include <deque>
+#include <map>
+#include <set>
+#include "map.hpp"
+#include "set.hpp"
+#include "multimap.hpp"
+#include "multiset.hpp"
+#include "btree_map.hpp"
+#include "btree_set.hpp"
+#include "flat_map.hpp"
+#include "flat_set.hpp"
+#include <unordered_map>
+#include <unordered_set>
+#include "unordered_map.hpp"
+#include "unordered_set.hpp"
+#include <stack>
+#include <queue>
+#include <mutex>
+#include "stack.hpp"
+#include "queue.hpp"
+#include "ring_buffer.hpp"
+// std::vector doubles on growth; compare ft::vector under the same policy.
+typedef ft::vector<int, std::allocator<int>, ft::grow_double> ft_int_vector;
+typedef ft::vector<std::string, std::allocator<std::string>, ft::grow_double>
+    ft_string_vector;
+
 bool single_digit(const int &value)
 {
     return value < 10 ? true : false;
@@ -63,6 +92,24 @@ void compare_vectors(const V1 &v1, const V2 &v2, const std::string &label)
 }
 
 // ---------- LIST HELPERS ----------
+struct timer_entry
+{
+    int deadline;
+    ft::list_hook by_deadline;
+    ft::list_hook by_owner;
+    bool operator<(const timer_entry &other) const { return deadline < other.deadline; }
+    bool operator==(const timer_entry &other) const { return deadline == other.deadline; }
+};
+
+template <typename IList>
+std::list<int> deadlines(const IList &lst)
+{
+    std::list<int> out;
+    for (typename IList::const_iterator it = lst.begin(); it != lst.end(); ++it)
+        out.push_back(it->deadline);
+    return out;
+}
+
 template <typename List>
 void print_list(const List &lst, const std::string &name)
 {
@@ -136,6 +183,84 @@ void compare_deque(const dq1 &que1, const dq2 &que2, const std::string &label)
     std::cout << "✅ Deques match" << std::endl;
 }
 
+// --- --- --- --- TREE CONTAINER HELPERS --- --- ---
+// Copying the value fail_on throws. Moves may throw too, so containers
+// fall back to copying it; a move leaves -1 behind.
+struct fragile_value
+{
+    int v;
+    static int fail_on;
+    fragile_value(int v = 0) : v(v) {}
+    fragile_value(const fragile_value &other) : v(other.v)
+    {
+        if (v == fail_on)
+            throw std::runtime_error("fragile_value copy");
+    }
+    fragile_value(fragile_value &&other) : v(other.v) { other.v = -1; }
+    fragile_value &operator=(const fragile_value &other) = default;
+};
+int fragile_value::fail_on = -1;
+
+struct copy_counter
+{
+    int v;
+    static int copies;
+    copy_counter(int v = 0) : v(v) {}
+    copy_counter(const copy_counter &other) : v(other.v) { ++copies; }
+};
+int copy_counter::copies = 0;
+
+template <typename T>
+void print_tree_value(const T &val)
+{
+    std::cout << val;
+}
+
+template <typename K, typename V>
+void print_tree_value(const std::pair<K, V> &val)
+{
+    std::cout << val.first << ":" << val.second;
+}
+
+template <typename T1, typename T2>
+bool same_tree_value(const T1 &a, const T2 &b)
+{
+    return a == b;
+}
+
+// flat_map hands out pairs of references, so compare members, not pairs.
+template <typename K1, typename V1, typename K2, typename V2>
+bool same_tree_value(const std::pair<K1, V1> &a, const std::pair<K2, V2> &b)
+{
+    return a.first == b.first && a.second == b.second;
+}
+
+template <typename T1, typename T2>
+void compare_tree(const T1 &t1, const T2 &t2, const std::string &label)
+{
+    std::cout << "==> " << label << " <==" << std::endl;
+    std::cout << "std (size=" << t1.size() << "): ";
+    for (typename T1::const_iterator it = t1.begin(); it != t1.end(); ++it)
+    {
+        print_tree_value(*it);
+        std::cout << " ";
+    }
+    std::cout << std::endl;
+
+    bool match = t1.size() == t2.size();
+    typename T2::const_iterator it2 = t2.begin();
+    for (typename T1::const_iterator it1 = t1.begin(); match && it1 != t1.end(); ++it1, ++it2)
+        match = same_tree_value(*it1, *it2);
+    typename T2::const_reverse_iterator rit2 = t2.rbegin();
+    for (typename T1::const_reverse_iterator rit1 = t1.rbegin(); match && rit1 != t1.rend(); ++rit1, ++rit2)
+        match = same_tree_value(*rit1, *rit2);
+    if (!match)
+    {
+        std::cout << "❌ Tree mismatch" << std::endl;
+        return;
+    }
+    std::cout << "✅ Trees match" << std::endl;
+}
 
 int main()
 {
@@ -143,8 +268,7 @@ int main()
 
     // --- 1. Fill constructor ---
     std::vector<int> std_v1(5, 42);
-    ft::vector<std::string> newstring;
-    ft::vector<int> ft_v1(5, 42);
+    ft_int_vector ft_v1(5, 42);
     compare_vectors(std_v1, ft_v1, "Fill constructor");
 
     // --- 2. push_back ---
@@ -200,7 +324,7 @@ int main()
 
     // --- 12. swap ---
     std::vector<int> std_v2(3, 7);
-    ft::vector<int> ft_v2(3, 7);
+    ft_int_vector ft_v2(3, 7);
     std_v1.swap(std_v2);
     ft_v1.swap(ft_v2);
     compare_vectors(std_v1, ft_v1, "swap v1 with v2 (part 1)");
@@ -228,7 +352,7 @@ int main()
     for (std::vector<int>::iterator it = std_v1.begin(); it != std_v1.end(); ++it)
         std::cout << *it << " ";
     std::cout << "\nft_v1 using iterator: ";
-    for (ft::vector<int>::iterator it = ft_v1.begin(); it != ft_v1.end(); ++it)
+    for (ft_int_vector::iterator it = ft_v1.begin(); it != ft_v1.end(); ++it)
         std::cout << *it << " ";
     std::cout << "\n";
     std::cout << "std_v1 using const_iterator: ";
@@ -237,7 +361,7 @@ int main()
          ++it)
         std::cout << *it << " ";
     std::cout << "\nft_v1 using const_iterator: ";
-    for (ft::vector<int>::const_iterator it = ft_v1.begin(); it !=
+    for (ft_int_vector::const_iterator it = ft_v1.begin(); it !=
                                                              ft_v1.end();
          ++it)
         std::cout << *it << " ";
@@ -268,6 +392,171 @@ int main()
     std_v1.shrink_to_fit();
     ft_v1.shrink_to_fit();
     compare_vectors(std_v1, ft_v1, "shrink two vectors");
+
+    // --- --- 18. growth relocates strings --- ---
+    std::vector<std::string> std_s1;
+    ft_string_vector ft_s1;
+    for (int i = 0; i < 40; i++)
+    {
+        std_s1.push_back(std::string(i + 20, char('a' + i % 26)));
+        ft_s1.push_back(std::string(i + 20, char('a' + i % 26)));
+    }
+    compare_vectors(std_s1, ft_s1, "push_back 40 long strings");
+
+    // --- --- 19. move constructor --- ---
+    std::vector<std::string> std_s2(std::move(std_s1));
+    ft_string_vector ft_s2(std::move(ft_s1));
+    compare_vectors(std_s2, ft_s2, "move construct string vector");
+    compare_vectors(std_s1, ft_s1, "moved-from string vector");
+
+    // --- --- 20. emplace constructs in place --- ---
+    std_s2.emplace_back(3, 'z');
+    ft_s2.emplace_back(3, 'z');
+    std_s2.emplace(std_s2.begin() + 5, 4, 'y');
+    ft_s2.emplace(ft_s2.begin() + 5, 4, 'y');
+    std_s2.push_back(std::string("rvalue"));
+    ft_s2.push_back(std::string("rvalue"));
+    compare_vectors(std_s2, ft_s2, "emplace_back(3, 'z') / emplace(4, 'y')");
+
+    // --- --- 21. range insert / assign --- ---
+    int range[] = {10, 20, 30, 40, 50, 60};
+    std_v1.insert(std_v1.begin() + 1, range, range + 6);
+    ft_v1.insert(ft_v1.begin() + 1, range, range + 6);
+    compare_vectors(std_v1, ft_v1, "insert range of 6 at index 1");
+    std_v1.assign(range + 2, range + 5);
+    ft_v1.assign(range + 2, range + 5);
+    compare_vectors(std_v1, ft_v1, "assign range of 3");
+    std::vector<int> std_v3(std_v1.begin(), std_v1.end());
+    ft_int_vector ft_v3(ft_v1.begin(), ft_v1.end());
+    compare_vectors(std_v3, ft_v3, "range constructor");
+
+    // --- --- 22. range erase / mid insert on strings --- ---
+    std_s2.erase(std_s2.begin() + 3, std_s2.begin() + 30);
+    ft_s2.erase(ft_s2.begin() + 3, ft_s2.begin() + 30);
+    compare_vectors(std_s2, ft_s2, "erase strings [3, 30)");
+    std_s2.insert(std_s2.begin() + 2, 3, "mid");
+    ft_s2.insert(ft_s2.begin() + 2, 3, "mid");
+    compare_vectors(std_s2, ft_s2, "insert 3x \"mid\" at index 2");
+
+    // --- --- 23. default growth policy --- ---
+    ft::vector<int> ft_grow;
+    std::vector<size_t> grown_capacities;
+    std::vector<size_t> expected_capacities;
+    size_t expected_cap = 0;
+    std::cout << "default growth capacities:";
+    for (size_t i = 0; i < 100; i++)
+    {
+        if (ft_grow.size() == ft_grow.capacity())
+        {
+            std::cout << " " << ft_grow.capacity();
+            grown_capacities.push_back(ft_grow.capacity());
+        }
+        if (i == expected_cap)
+        {
+            expected_capacities.push_back(expected_cap);
+            expected_cap = std::max(ft::grow_one_and_half::next_capacity(expected_cap, i + 1, sizeof(int)),
+                                    i + 1);
+        }
+        ft_grow.push_back(i);
+    }
+    std::cout << " " << ft_grow.capacity() << "\n";
+    grown_capacities.push_back(ft_grow.capacity());
+    expected_capacities.push_back(expected_cap);
+    if (ft_grow.size() != 100 || ft_grow[99] != 99)
+        std::cout << "❌ default growth lost elements!\n";
+    else if (grown_capacities != expected_capacities)
+        std::cout << "❌ default growth does not follow grow_one_and_half!\n";
+    else
+        std::cout << "✅ default growth follows grow_one_and_half\n";
+
+    // --- --- 24. small_vector stays inline until it overflows --- ---
+    std::vector<int> std_small;
+    ft::small_vector<int, 8> ft_small;
+    for (int i = 0; i < 8; i++)
+    {
+        std_small.push_back(i * 3);
+        ft_small.push_back(i * 3);
+    }
+    print_vector(ft_small, "ft::small_vector");
+    if (!ft_small.is_inline())
+        std::cout << "❌ small_vector spilled before reaching N!\n";
+    std_small.insert(std_small.begin() + 4, 3, -1);
+    ft_small.insert(ft_small.begin() + 4, 3, -1);
+    print_vector(ft_small, "ft::small_vector");
+    if (ft_small.is_inline() || ft_small.size() != std_small.size() ||
+        !std::equal(std_small.begin(), std_small.end(), ft_small.begin()))
+        std::cout << "❌ small_vector overflow mismatch!\n";
+    else
+        std::cout << "✅ small_vector matches after spilling to the heap\n";
+    ft::pool_allocator<int> small_pool = ft::pool_allocator<int>::share();
+    ft::small_vector<int, 4, ft::pool_allocator<int>> ft_small_pooled(small_pool);
+    for (int i = 0; i < 10; i++)
+        ft_small_pooled.push_back(i);
+    ft::small_vector<int, 4, ft::pool_allocator<int>> ft_small_copy(ft_small_pooled);
+    ft::small_vector<int, 4, ft::pool_allocator<int>> ft_small_moved(std::move(ft_small_pooled));
+    if (ft_small_copy.get_allocator().upstream() != small_pool ||
+        ft_small_moved.get_allocator().upstream() != small_pool ||
+        ft_small_copy.size() != 10 || ft_small_moved.size() != 10 || ft_small_moved[9] != 9)
+        std::cout << "❌ small_vector copy/move dropped its pool!\n";
+    else
+        std::cout << "✅ small_vector copy/move keep the source's pool\n";
+    ft::small_vector<int, 4, ft::pool_allocator<int>> ft_small_other(ft::pool_allocator<int>::share());
+    {
+        ft::small_vector<int, 4, ft::pool_allocator<int>> ft_small_donor(ft::pool_allocator<int>::share());
+        for (int i = 0; i < 10; i++)
+            ft_small_donor.push_back(i);
+        ft_small_other = std::move(ft_small_donor);
+    }
+    for (int i = 10; i < 40; i++)
+        ft_small_other.push_back(i);
+    bool kept_values = ft_small_other.size() == 40;
+    for (int i = 0; kept_values && i < 40; i++)
+        kept_values = ft_small_other[i] == i;
+    if (!kept_values)
+        std::cout << "❌ small_vector move assignment across pools!\n";
+    else
+        std::cout << "✅ small_vector move assignment across pools keeps its own pool\n";
+    ft::small_vector<int, 8> ft_small_shrunk(2, 7);
+    ft_small_shrunk.shrink_to_fit();
+    bool shrunk_inline = ft_small_shrunk.is_inline() && ft_small_shrunk.capacity() == 8;
+    ft_small_shrunk.assign(20, 7);
+    ft_small_shrunk.shrink_to_fit();
+    bool shrunk_heap = !ft_small_shrunk.is_inline() && ft_small_shrunk.capacity() == 20;
+    ft_small_shrunk.resize(3);
+    ft_small_shrunk.shrink_to_fit();
+    bool shrunk_back = ft_small_shrunk.is_inline() && ft_small_shrunk.capacity() == 8 &&
+                       ft_small_shrunk.size() == 3 && ft_small_shrunk[2] == 7;
+    if (!shrunk_inline || !shrunk_heap || !shrunk_back)
+        std::cout << "❌ small_vector shrink_to_fit left the arena!\n";
+    else
+        std::cout << "✅ small_vector shrink_to_fit stays in or returns to the arena\n";
+
+    // --- --- 25. resize / resize_uninitialized --- ---
+    std_v3.resize(12, 9);
+    ft_v3.resize(12, 9);
+    compare_vectors(std_v3, ft_v3, "resize(12, 9)");
+    ft::vector<char> ft_buf;
+    ft_buf.resize_uninitialized(4096);
+    for (size_t i = 0; i < ft_buf.size(); i++)
+        ft_buf[i] = char('a' + i % 26);
+    if (ft_buf.size() != 4096 || ft_buf[27] != 'b')
+        std::cout << "❌ resize_uninitialized lost the buffer!\n";
+    else
+        std::cout << "✅ resize_uninitialized(4096) filled in place\n";
+
+    // --- --- 26. relational operators on long byte vectors --- ---
+    std::vector<char> std_k1(100, 'k');
+    std::vector<char> std_k2(std_k1);
+    ft::vector<char> ft_k1(100, 'k');
+    ft::vector<char> ft_k2(ft_k1);
+    std_k2[70] = 'j';
+    ft_k2[70] = 'j';
+    std::cout << "std_k1 == std_k2: " << (std_k1 == std_k2)
+              << " | std_k2 < std_k1: " << (std_k2 < std_k1) << "\n";
+    std::cout << "ft_k1 == ft_k2: " << (ft_k1 == ft_k2)
+              << " | ft_k2 < ft_k1: " << (ft_k2 < ft_k1) << "\n";
+    if ((std_k1 == std_k2) != (ft_k1 == ft_k2) || (std_k2 < std_k1) != (ft_k2 < ft_k1))
+        std::cout << "❌ byte vector comparison mismatch!\n";
     std::cout << "\n===== TESTS COMPLETE =====\n";
 
     std::cout << "\n===== LIST TESTS =====\n\n";
@@ -465,6 +754,32 @@ int main()
     ft_l1.sort(same_integral_part);
     compare_lists(std_l1, ft_l1, "compare two list after sort");
 
+    int presorted[] = {1, 2, 3, 9, 8, 7, 4, 4, 5, 0};
+    std::list<int> std_runs(presorted, presorted + 10);
+    ft::list<int> ft_runs;
+    ft_runs.assign(presorted, presorted + 10);
+    std_runs.sort();
+    ft_runs.sort();
+    compare_lists(std_runs, ft_runs, "sort over ascending and descending runs");
+    ft_runs.assign(presorted, presorted + 10);
+    ft_runs.sort_buffered(std::greater<int>());
+    std_runs.sort(std::greater<int>());
+    compare_lists(std_runs, ft_runs, "sort_buffered with greater");
+    std::list<int> std_big;
+    ft::list<int> ft_big;
+    for (int i = 0; i < 20000; i++)
+    {
+        std_big.push_back(i * 7919 % 20011);
+        ft_big.push_back(i * 7919 % 20011);
+    }
+    std_big.sort(std::greater<int>());
+    ft_big.parallel_sort(std::greater<int>(), 4);
+    std::cout << "=== parallel_sort(greater, 4 threads) over 20000 elements ===\n"
+              << (std_big.size() == ft_big.size() &&
+                          std::equal(std_big.begin(), std_big.end(), ft_big.begin())
+                      ? "✅ Lists match!\n\n"
+                      : "❌ Mismatch!\n\n");
+
     // --- --- 19.merge --- ---
     std::list<int> std_newlist;
     ft::list<int> ft_newlist;
@@ -487,6 +802,165 @@ int main()
     std_l1.reverse();
     ft_l1.reverse();
      compare_lists(std_l1, ft_l1, "reverse two list after sort");
+    std::cout << "last via --end(): std=" << *--std_l1.end() << ", ft=" << *--ft_l1.end()
+              << (std::equal(std_l1.rbegin(), std_l1.rend(), ft_l1.rbegin()) ? "\n✅ Reverse iteration matches!\n\n"
+                                                                            : "\n❌ Reverse iteration mismatch!\n\n");
+
+    // --- --- 20.pooled nodes --- ---
+    std::list<int> std_lru;
+    ft::list<int, ft::pool_allocator<int>> ft_lru;
+    for (int i = 0; i < 10000; i++)
+    {
+        std_lru.push_front(i);
+        ft_lru.push_front(i);
+        if (std_lru.size() > 16)
+        {
+            std_lru.pop_back();
+            ft_lru.pop_back();
+        }
+    }
+    compare_lists(std_lru, ft_lru, "pooled list after 10000 LRU updates");
+    ft::pool_allocator<int> shared_pool = ft::pool_allocator<int>::share();
+    ft::list<int, ft::pool_allocator<int>> ft_pooled_a(shared_pool);
+    ft::list<int, ft::pool_allocator<int>> ft_pooled_b(3, 5, shared_pool);
+    ft_pooled_a.push_back(1);
+    ft_pooled_a.splice(ft_pooled_a.end(), ft_pooled_b);
+    std::list<int> std_pooled(1, 1);
+    std_pooled.insert(std_pooled.end(), 3, 5);
+    compare_lists(std_pooled, ft_pooled_a, "splice between lists sharing a pool");
+    ft::list<int, ft::pool_allocator<int>> ft_pooled_c;
+    ft::list<int, ft::pool_allocator<int>> ft_pooled_d;
+    ft_pooled_d.push_back(0);
+    ft_pooled_d.push_back(7);
+    {
+        ft::list<int, ft::pool_allocator<int>> ft_donor;
+        ft::list<int, ft::pool_allocator<int>> ft_donor_sorted;
+        for (int i = 1; i <= 4; i++)
+        {
+            ft_donor.push_back(i);
+            ft_donor_sorted.push_back(i * 3);
+        }
+        ft_pooled_c.splice(ft_pooled_c.end(), ft_donor, ft_donor.begin());
+        ft_pooled_c.splice(ft_pooled_c.end(), ft_donor);
+        ft_pooled_d.merge(ft_donor_sorted);
+    }
+    ft_pooled_c.push_back(5);
+    std::list<int> std_spliced;
+    std::list<int> std_merged;
+    for (int i = 1; i <= 5; i++)
+        std_spliced.push_back(i);
+    int merged_values[] = {0, 3, 6, 7, 9, 12};
+    std_merged.assign(merged_values, merged_values + 6);
+    compare_lists(std_spliced, ft_pooled_c, "splice from a private pool whose list died first");
+    compare_lists(std_merged, ft_pooled_d, "merge from a private pool whose list died first");
+    ft::list<fragile_value, ft::pool_allocator<fragile_value> > ft_fragile_to;
+    ft::list<fragile_value, ft::pool_allocator<fragile_value> > ft_fragile_from;
+    ft_fragile_to.push_back(fragile_value(-5));
+    for (int i = 0; i < 10; i++)
+        ft_fragile_from.push_back(fragile_value(i));
+    bool splice_threw = false;
+    fragile_value::fail_on = 5;
+    try
+    {
+        ft_fragile_to.splice(ft_fragile_to.end(), ft_fragile_from);
+    }
+    catch (const std::runtime_error &)
+    {
+        splice_threw = true;
+    }
+    fragile_value::fail_on = -1;
+    bool donor_intact = splice_threw && ft_fragile_to.size() == 1 && ft_fragile_from.size() == 10;
+    int expected_fragile = 0;
+    for (ft::list<fragile_value, ft::pool_allocator<fragile_value> >::iterator it = ft_fragile_from.begin();
+         donor_intact && it != ft_fragile_from.end(); ++it)
+        donor_intact = it->v == expected_fragile++;
+    std::cout << (donor_intact ? "✅" : "❌") << " splice across pools that throws keeps the donor's values\n";
+
+    // --- --- 21.intrusive list --- ---
+    timer_entry timers[8];
+    int timer_deadlines[] = {40, 10, 30, 10, 20, 50, 30, 60};
+    ft::intrusive_list<timer_entry, &timer_entry::by_deadline> ft_by_deadline;
+    ft::intrusive_list<timer_entry, &timer_entry::by_owner> ft_by_owner;
+    std::list<int> std_timers;
+    for (int i = 0; i < 8; i++)
+    {
+        timers[i].deadline = timer_deadlines[i];
+        ft_by_deadline.push_back(timers[i]);
+        if (i % 2)
+            ft_by_owner.push_front(timers[i]);
+        std_timers.push_back(timer_deadlines[i]);
+    }
+    std_timers.sort();
+    ft_by_deadline.sort();
+    compare_lists(std_timers, deadlines(ft_by_deadline), "intrusive_list sort");
+    std_timers.unique();
+    ft_by_deadline.unique();
+    std_timers.remove_if([](int x)
+                         { return x > 40; });
+    ft_by_deadline.remove_if([](const timer_entry &t)
+                             { return t.deadline > 40; });
+    compare_lists(std_timers, deadlines(ft_by_deadline), "intrusive_list unique + remove_if");
+    std::list<int> walked_back;
+    for (auto it = ft_by_deadline.end(); it != ft_by_deadline.begin();)
+        walked_back.push_back((--it)->deadline);
+    std::list<int> std_timers_back(std_timers.rbegin(), std_timers.rend());
+    compare_lists(std_timers_back, walked_back, "intrusive_list walk back from end()");
+    std::cout << "intrusive_list prev(end()) is back(): "
+              << (ft_by_deadline.empty() || &*std::prev(ft_by_deadline.end()) == &ft_by_deadline.back() ? "✅" : "❌")
+              << "\n";
+    ft_by_deadline.reverse();
+    compare_lists(std_timers_back, deadlines(ft_by_deadline), "intrusive_list reverse");
+    ft_by_deadline.reverse();
+    std::cout << "same timers in a second list: " << ft_by_owner.size()
+              << ", timers[5] still linked: " << timers[5].by_owner.is_linked() << "\n";
+    std::list<int> std_owned;
+    for (int i = 7; i > 0; i -= 2)
+        std_owned.push_back(timer_deadlines[i]);
+    compare_lists(std_owned, deadlines(ft_by_owner), "intrusive_list through a second hook");
+
+    // --- --- 22.unrolled list --- ---
+    std::list<int> std_events;
+    ft::unrolled_list<int, std::allocator<int>, 32> ft_events;
+    for (int i = 0; i < 50; i++)
+    {
+        std_events.push_back(i * 7 % 50);
+        ft_events.push_back(i * 7 % 50);
+    }
+    std_events.push_front(-1);
+    ft_events.push_front(-1);
+    std_events.insert(++std_events.begin(), 99);
+    ft_events.insert(++ft_events.begin(), 99);
+    compare_lists(std_events, ft_events, "unrolled_list push + insert");
+    std_events.remove_if([](int x)
+                         { return x % 3 == 0; });
+    ft_events.remove_if([](int x)
+                        { return x % 3 == 0; });
+    std_events.sort();
+    ft_events.sort();
+    compare_lists(std_events, ft_events, "unrolled_list remove_if + sort");
+    std::list<int> std_more(5, 8);
+    ft::unrolled_list<int, std::allocator<int>, 32> ft_more(5, 8);
+    std_events.splice(std_events.begin(), std_more);
+    ft_events.splice(ft_events.begin(), ft_more);
+    compare_lists(std_events, ft_events, "unrolled_list splice at front");
+    int segment_sum = 0;
+    ft_events.for_each_segment([&segment_sum](const int *first, const int *last)
+                               { for (; first != last; ++first) segment_sum += *first; });
+    std::cout << "sum over segments: " << segment_sum << "\n";
+    std::list<int> std_events_more(std_events);
+    ft::unrolled_list<int, std::allocator<int>, 32> ft_events_more(ft_events);
+    std_events_more.push_back(1);
+    ft_events_more.push_back(1);
+    bool std_order[] = {std_events > std_events_more, std_events <= std_events_more,
+                        std_events >= std_events_more, std_events_more > std_events};
+    bool ft_order[] = {ft_events > ft_events_more, ft_events <= ft_events_more,
+                       ft_events >= ft_events_more, ft_events_more > ft_events};
+    std::cout << (std::equal(std_order, std_order + 4, ft_order) ? "✅" : "❌")
+              << " unrolled_list >, <= and >= agree with std::list\n";
+    ft::unrolled_list<int, ft::pool_allocator<int>, 32> ft_pooled_events(ft_events.begin(), ft_events.end());
+    ft_pooled_events.sort(std::greater<int>());
+    std_events.sort(std::greater<int>());
+    compare_lists(std_events, ft_pooled_events, "pooled unrolled_list sort");
 
     std::cout << "\n===== TESTS LIST CONTAINER COMPLETE =====\n";
     std::cout << "\n===== TESTS DEQUE =====\n";
@@ -502,6 +976,358 @@ int main()
     std::cout << std::endl;
     ft::deque<int> ftd(second.begin(), second.end());
     compare_deque(newd, ftd, "compare two deque");
+
+    // --- random access iterators ---
+    std::deque<int> std_dq;
+    ft::deque<int> ft_dq;
+    for (int i = 0; i < 150; i++)
+    {
+        std_dq.push_back((i * 37) % 101);
+        ft_dq.push_back((i * 37) % 101);
+        std_dq.push_front(i % 13);
+        ft_dq.push_front(i % 13);
+    }
+    std::sort(std_dq.begin(), std_dq.end());
+    std::sort(ft_dq.begin(), ft_dq.end());
+    compare_deque(std_dq, ft_dq, "std::sort over 300 elements");
+    long std_lower = std::lower_bound(std_dq.begin(), std_dq.end(), 50) - std_dq.begin();
+    long ft_lower = std::lower_bound(ft_dq.begin(), ft_dq.end(), 50) - ft_dq.begin();
+    std::cout << (std_lower == ft_lower ? "✅" : "❌") << " lower_bound(50): std=" << std_lower
+              << " ft=" << ft_lower << std::endl;
+    long dq_sum = 0;
+    int dq_segments = 0;
+    ft_dq.for_each_segment(ft_dq.begin() + 7, ft_dq.end() - 5,
+                           [&dq_sum, &dq_segments](const int *first, const int *last)
+                           { for (++dq_segments; first != last; ++first) dq_sum += *first; });
+    long std_sum = 0;
+    for (std::deque<int>::const_iterator it = std_dq.begin() + 7; it != std_dq.end() - 5; ++it)
+        std_sum += *it;
+    std::cout << (dq_sum == std_sum && dq_segments > 1 ? "✅" : "❌")
+              << " for_each_segment over [7, size - 5): " << dq_segments << " segments, sum " << dq_sum << std::endl;
+    typedef std::iterator_traits<ft::deque<int>::const_iterator>::value_type dq_const_value;
+    std::vector<dq_const_value> dq_copy(ft_dq.begin(), ft_dq.end());
+    std::cout << (std::is_same<dq_const_value, int>::value && dq_copy.size() == ft_dq.size() ? "✅" : "❌")
+              << " deque const_iterator value_type is T" << std::endl;
+
+    // --- sliding FIFO recycles blocks ---
+    for (int i = 0; i < 100000; i++)
+    {
+        std_dq.push_back(i);
+        ft_dq.push_back(i);
+        std_dq.pop_front();
+        ft_dq.pop_front();
+    }
+    ft_dq.shrink_to_fit();
+    compare_deque(std_dq, ft_dq, "after sliding 100000 elements through");
+
+    // --- block size chosen from a byte budget ---
+    std::deque<int> std_small_dq;
+    ft::deque<int, std::allocator<int>, 64> ft_small_dq;
+    for (int i = 0; i < 100; i++)
+    {
+        std_small_dq.push_front(i);
+        ft_small_dq.push_front(i);
+    }
+    compare_deque(std_small_dq, ft_small_dq, "deque with 64-byte blocks");
+
+    // --- bulk append / prepend / drain ---
+    int batch[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    std_small_dq.insert(std_small_dq.end(), batch, batch + 8);
+    ft_small_dq.append(batch, batch + 8);
+    std_small_dq.insert(std_small_dq.begin(), batch, batch + 8);
+    ft_small_dq.prepend(batch, batch + 8);
+    compare_deque(std_small_dq, ft_small_dq, "append + prepend 8 elements");
+    std_small_dq.erase(std_small_dq.begin(), std_small_dq.begin() + 20);
+    ft_small_dq.pop_front_n(20);
+    std_small_dq.erase(std_small_dq.end() - 30, std_small_dq.end());
+    ft_small_dq.pop_back_n(30);
+    compare_deque(std_small_dq, ft_small_dq, "pop_front_n(20) + pop_back_n(30)");
+    int drained[16];
+    int *drained_end = ft_small_dq.drain_front(16, drained);
+    std_small_dq.erase(std_small_dq.begin(), std_small_dq.begin() + 16);
+    std::cout << "drained " << drained_end - drained << " elements, first "
+              << drained[0] << std::endl;
+    compare_deque(std_small_dq, ft_small_dq, "after drain_front(16)");
+
+    // --- copies hold only the live elements ---
+    std::deque<std::string> std_str_dq;
+    ft::deque<std::string, std::allocator<std::string>, 64> ft_str_dq;
+    for (int i = 0; i < 40; i++)
+    {
+        std_str_dq.push_front("front" + std::to_string(i));
+        ft_str_dq.push_front("front" + std::to_string(i));
+        std_str_dq.push_back("back" + std::to_string(i));
+        ft_str_dq.push_back("back" + std::to_string(i));
+    }
+    std_str_dq.erase(std_str_dq.begin(), std_str_dq.begin() + 13);
+    ft_str_dq.pop_front_n(13);
+    std::deque<std::string> std_str_copy(std_str_dq);
+    ft::deque<std::string, std::allocator<std::string>, 64> ft_str_copy(ft_str_dq);
+    compare_deque(std_str_copy, ft_str_copy, "copy of a partly drained deque");
+    std_str_copy = std_str_dq;
+    ft_str_copy.pop_back_n(5);
+    ft_str_copy = ft_str_dq;
+    compare_deque(std_str_copy, ft_str_copy, "copy-assign over a shorter deque");
     std::cout << "\n===== TESTS DEQUE CONTAINER COMPLETE =====\n";
+
+    std::cout << "\n===== TREE TESTS =====\n\n";
+    // --- map: operator[], erase, hinted insert ---
+    std::map<int, std::string> std_map;
+    ft::map<int, std::string> ft_map;
+    for (int i = 0; i < 20; i++)
+    {
+        std_map[(i * 7) % 20] = std::to_string(i);
+        ft_map[(i * 7) % 20] = std::to_string(i);
+    }
+    std_map.erase(3);
+    ft_map.erase(3);
+    std_map.erase(std_map.begin());
+    ft_map.erase(ft_map.begin());
+    std_map.insert(std_map.end(), std::make_pair(40, "tail"));
+    ft_map.insert(ft_map.end(), std::make_pair(40, "tail"));
+    compare_tree(std_map, ft_map, "map after [] / erase / hinted insert");
+    ft::map<int, std::string> ft_map_copy;
+    ft_map_copy[-1] = "gone";
+    ft_map_copy = ft_map;
+    compare_tree(std_map, ft_map_copy, "map copy-assigned over another");
+
+    // --- set / multiset / multimap ---
+    int keys[] = {5, 1, 9, 1, 7, 5, 3, 9, 9};
+    std::set<int> std_set(keys, keys + 9);
+    ft::set<int> ft_set(keys, keys + 9);
+    compare_tree(std_set, ft_set, "set from range with duplicates");
+    std::multiset<int, std::greater<int> > std_mset(keys, keys + 9);
+    ft::multiset<int, std::greater<int>, ft::pool_allocator<int> > ft_mset(keys, keys + 9);
+    std_mset.erase(9);
+    ft_mset.erase(9);
+    compare_tree(std_mset, ft_mset, "pooled multiset<greater> after erase(9)");
+    ft::pool_allocator<int> set_pool_a = ft::pool_allocator<int>::share();
+    ft::pool_allocator<int> set_pool_b = ft::pool_allocator<int>::share();
+    ft::set<int, std::less<int>, ft::pool_allocator<int> > ft_pooled_set_a(keys, keys + 4, std::less<int>(), set_pool_a);
+    ft::set<int, std::less<int>, ft::pool_allocator<int> > ft_pooled_set_b(keys + 4, keys + 9, std::less<int>(), set_pool_b);
+    ft_pooled_set_a.swap(ft_pooled_set_b);
+    bool swapped_allocs = ft_pooled_set_a.get_allocator() == set_pool_b &&
+                          ft_pooled_set_b.get_allocator() == set_pool_a;
+    ft_pooled_set_b = std::move(ft_pooled_set_a);
+    swapped_allocs = swapped_allocs && ft_pooled_set_b.get_allocator() == set_pool_b;
+    std::cout << (swapped_allocs ? "✅" : "❌") << " set swap / move carry get_allocator() along" << std::endl;
+    std::multimap<int, int> std_mmap;
+    ft::multimap<int, int> ft_mmap;
+    for (int i = 0; i < 9; i++)
+    {
+        std_mmap.insert(std::make_pair(keys[i], i));
+        ft_mmap.insert(std::make_pair(keys[i], i));
+    }
+    std::cout << "multimap count(9): std=" << std_mmap.count(9)
+              << " ft=" << ft_mmap.count(9) << std::endl;
+    compare_tree(std_mmap, ft_mmap, "multimap keeps equal keys in insertion order");
+
+    // --- btree_map / btree_set with narrow nodes to force splits ---
+    std::map<int, std::string> std_bmap;
+    ft::btree_map<int, std::string, std::less<int>,
+                  std::allocator<std::pair<const int, std::string> >, 64> ft_bmap;
+    for (int i = 0; i < 200; i++)
+    {
+        std_bmap[(i * 37) % 200] = std::to_string(i);
+        ft_bmap[(i * 37) % 200] = std::to_string(i);
+    }
+    for (int i = 0; i < 200; i += 3)
+    {
+        std_bmap.erase(i);
+        ft_bmap.erase(i);
+    }
+    compare_tree(std_bmap, ft_bmap, "btree_map after 200 inserts and erasing every third key");
+    std::set<int> std_bset;
+    ft::btree_set<int, std::less<int>, std::allocator<int>, 32> ft_bset;
+    for (int i = 0; i < 100; i++)
+    {
+        std_bset.insert(std_bset.end(), i * 2);
+        ft_bset.insert(ft_bset.end(), i * 2);
+    }
+    compare_tree(std_bset, ft_bset, "btree_set bulk-loaded from sorted input");
+    int scanned = 0;
+    ft_bset.for_each_segment(ft_bset.lower_bound(50), ft_bset.lower_bound(150),
+                             [&scanned](const int *first, const int *last)
+                             { scanned += last - first; });
+    std::cout << "keys in [50, 150): std=" << std::distance(std_bset.lower_bound(50), std_bset.lower_bound(150))
+              << " ft=" << scanned << std::endl;
+    std::vector<std::pair<std::string, int> > named_ports;
+    for (int i = 0; i < 40; i++)
+        named_ports.push_back(std::make_pair("port number " + std::to_string(i % 25), i));
+    std::map<std::string, int> std_named(named_ports.begin(), named_ports.end());
+    ft::btree_map<std::string, int, std::less<std::string>,
+                  std::allocator<std::pair<const std::string, int> >, 128>
+        ft_named(named_ports.begin(), named_ports.end());
+    compare_tree(std_named, ft_named, "btree_map from non-value_type pairs");
+    const char *host_names[] = {"delta", "alpha", "charlie", "bravo", "alpha", "echo"};
+    std::set<std::string> std_hosts(host_names, host_names + 6);
+    ft::btree_set<std::string> ft_hosts(host_names, host_names + 6);
+    compare_tree(std_hosts, ft_hosts, "btree_set<string> from const char *");
+
+    // --- flat_map / flat_set: bulk insert sorts and merges once ---
+    std::vector<std::pair<int, std::string> > routes;
+    for (int i = 0; i < 30; i++)
+        routes.push_back(std::make_pair((i * 11) % 17, "r" + std::to_string(i)));
+    std::map<int, std::string> std_fmap(routes.begin(), routes.end());
+    ft::flat_map<int, std::string> ft_fmap(routes.begin(), routes.end());
+    compare_tree(std_fmap, ft_fmap, "flat_map from 30 routes over 17 keys");
+    std_fmap.insert(routes.begin() + 5, routes.end());
+    ft_fmap.insert(routes.begin() + 5, routes.end());
+    std_fmap[40] = "late";
+    ft_fmap[40] = "late";
+    std_fmap.erase(std_fmap.begin());
+    ft_fmap.erase(ft_fmap.begin());
+    compare_tree(std_fmap, ft_fmap, "flat_map after re-insert, [] and erase");
+    ft::pool_allocator<std::pair<int, std::string> > fmap_pool =
+        ft::pool_allocator<std::pair<int, std::string> >::share();
+    ft::flat_map<int, std::string, std::less<int>, ft::pool_allocator<std::pair<int, std::string> > >
+        ft_pooled_fmap(routes.begin(), routes.end(), std::less<int>(), fmap_pool);
+    std::cout << (ft_pooled_fmap.get_allocator() == fmap_pool && ft_pooled_fmap.size() == 17 ? "✅" : "❌")
+              << " flat_map keeps the allocator it was built with" << std::endl;
+    ft::flat_map<int, fragile_value> ft_fragile;
+    for (int i = 0; i < 10; i++)
+        ft_fragile.insert(std::make_pair(i * 2, fragile_value(i)));
+    std::vector<std::pair<int, fragile_value> > fragile_more;
+    for (int i = 0; i < 5; i++)
+        fragile_more.push_back(std::make_pair(i * 4 + 1, fragile_value(100 + i)));
+    bool fragile_threw = false;
+    fragile_value::fail_on = 5;
+    try
+    {
+        ft_fragile.insert(fragile_more.begin(), fragile_more.end());
+    }
+    catch (const std::runtime_error &)
+    {
+        fragile_threw = true;
+    }
+    fragile_value::fail_on = -1;
+    bool fragile_intact = fragile_threw && ft_fragile.size() == 10;
+    for (int i = 0; fragile_intact && i < 10; i++)
+        fragile_intact = ft_fragile.at(i * 2).v == i;
+    std::cout << (fragile_intact ? "✅" : "❌") << " flat_map bulk insert that throws leaves the map intact" << std::endl;
+    std::set<int> std_fset(keys, keys + 9);
+    ft::flat_set<int> ft_fset(keys, keys + 9);
+    std_fset.insert(4);
+    ft_fset.insert(4);
+    compare_tree(std_fset, ft_fset, "flat_set from range with duplicates");
+
+    // --- unordered_map / unordered_set: compared through sorted copies ---
+    std::unordered_map<int, std::string> std_umap;
+    ft::unordered_map<int, std::string> ft_umap;
+    for (int i = 0; i < 100; i++)
+    {
+        std_umap[(i * 13) % 60] = std::to_string(i);
+        ft_umap[(i * 13) % 60] = std::to_string(i);
+    }
+    for (std::unordered_map<int, std::string>::iterator it = std_umap.begin(); it != std_umap.end();)
+        it = it->first % 3 == 0 ? std_umap.erase(it) : std::next(it);
+    for (ft::unordered_map<int, std::string>::iterator it = ft_umap.begin(); it != ft_umap.end();)
+        it = it->first % 3 == 0 ? ft_umap.erase(it) : std::next(it);
+    compare_tree(std::map<int, std::string>(std_umap.begin(), std_umap.end()),
+                 std::map<int, std::string>(ft_umap.begin(), ft_umap.end()),
+                 "unordered_map after [] and erasing while iterating");
+    // Range erase must hand back an iterator that still reaches every key
+    // that followed the range, even when the repair moves them.
+    ft::unordered_map<int, int> ft_urange;
+    for (int k = 154; k <= 161; k++)
+        ft_urange[k] = k;
+    ft::unordered_map<int, int>::iterator range_last = std::next(ft_urange.begin(), 4);
+    std::set<int> std_after;
+    for (ft::unordered_map<int, int>::iterator it = range_last; it != ft_urange.end(); ++it)
+        std_after.insert(it->first);
+    std::set<int> ft_after;
+    for (ft::unordered_map<int, int>::iterator it = ft_urange.erase(ft_urange.begin(), range_last);
+         it != ft_urange.end(); ++it)
+        ft_after.insert(it->first);
+    compare_tree(std_after, ft_after, "unordered_map range erase reaches every later key");
+    std::vector<std::pair<int, copy_counter> > counted_pairs;
+    for (int i = 0; i < 100; i++)
+        counted_pairs.push_back(std::make_pair(i % 50, copy_counter(i)));
+    copy_counter::copies = 0;
+    ft::unordered_map<int, copy_counter> ft_counted(counted_pairs.begin(), counted_pairs.end());
+    std::cout << (copy_counter::copies == 50 && ft_counted.size() == 50 ? "✅" : "❌")
+              << " unordered_map from 100 pairs over 50 keys copies " << copy_counter::copies
+              << " values" << std::endl;
+    std::unordered_set<int> std_uset(keys, keys + 9);
+    ft::unordered_set<int> ft_uset(keys, keys + 9);
+    ft_uset.reserve(1000);
+    std::cout << "unordered_set count(7): std=" << std_uset.count(7)
+              << " ft=" << ft_uset.count(7) << std::endl;
+    compare_tree(std::set<int>(std_uset.begin(), std_uset.end()),
+                 std::set<int>(ft_uset.begin(), ft_uset.end()),
+                 "unordered_set from range with duplicates, reserved");
+
+    std::cout << "\n===== STACK / QUEUE TESTS =====\n\n";
+    // --- stack over deque and vector, queue over deque and list ---
+    int seq[] = {4, 8, 15, 16, 23, 42};
+    std::stack<int> std_stack;
+    ft::stack<int> ft_stack;
+    ft::stack<int, ft::vector<int> > ft_vstack;
+    for (int i = 0; i < 6; i++)
+        std_stack.push(seq[i]);
+    ft_stack.push_range(seq, seq + 6);
+    ft_vstack.push_range(seq, seq + 4);
+    ft_vstack.emplace(23);
+    ft_vstack.push(42);
+    std::list<int> std_popped, ft_popped, ft_vpopped;
+    for (; !std_stack.empty(); std_stack.pop())
+        std_popped.push_back(std_stack.top());
+    while (!ft_stack.empty())
+        ft_popped.push_back(ft_stack.pop());
+    while (!ft_vstack.empty())
+        ft_vpopped.push_back(ft_vstack.pop());
+    compare_lists(std_popped, ft_popped, "stack<deque> pops in LIFO order");
+    compare_lists(std_popped, ft_vpopped, "stack<vector> pops in LIFO order");
+    std::queue<std::string> std_queue;
+    ft::queue<std::string> ft_queue;
+    ft::queue<std::string, ft::list<std::string> > ft_lqueue;
+    for (int i = 0; i < 6; i++)
+    {
+        std_queue.push(std::to_string(seq[i]));
+        ft_queue.emplace(std::to_string(seq[i]));
+        ft_lqueue.push(std::to_string(seq[i]));
+    }
+    std::cout << "queue front/back: std=" << std_queue.front() << "/" << std_queue.back()
+              << " ft=" << ft_queue.front() << "/" << ft_queue.back() << std::endl;
+    std::list<std::string> std_served, ft_served, ft_lserved;
+    for (; !std_queue.empty(); std_queue.pop())
+        std_served.push_back(std_queue.front());
+    while (!ft_queue.empty())
+        ft_served.push_back(ft_queue.pop());
+    while (!ft_lqueue.empty())
+        ft_lserved.push_back(ft_lqueue.pop());
+    compare_lists(std_served, ft_served, "queue<deque> pops in FIFO order");
+    compare_lists(std_served, ft_lserved, "queue<list> pops in FIFO order");
+    ft::queue<std::mutex, ft::list<std::mutex> > ft_locks;
+    ft_locks.emplace();
+    ft_locks.emplace();
+    bool emplaced_locks = ft_locks.size() == 2 && ft_locks.back().try_lock();
+    if (emplaced_locks)
+        ft_locks.back().unlock();
+    std::cout << (emplaced_locks ? "✅" : "❌") << " queue<list> emplaces a type it cannot move" << std::endl;
+
+    // --- ring_buffer: overwrite-oldest, reject-newest, queue on top ---
+    std::deque<int> std_window;
+    ft::ring_buffer<int, 8, ft::ring_overwrite> ft_window;
+    for (int i = 0; i < 13; i++)
+    {
+        std_window.push_back(i);
+        if (std_window.size() > 8)
+            std_window.pop_front();
+        ft_window.push_back(i);
+    }
+    compare_deque(std_window, ft_window, "ring_buffer<8, overwrite> keeps the newest 8 of 13");
+    std::deque<int> std_bounded(seq, seq + 4);
+    ft::ring_buffer<int> ft_bounded(4);
+    std::size_t taken = ft_bounded.append(seq, seq + 6);
+    bool pushed = ft_bounded.push_back(99);
+    std::cout << "ring_buffer(4) append of 6 takes " << taken
+              << ", push when full returns " << pushed << std::endl;
+    compare_deque(std_bounded, ft_bounded, "ring_buffer<reject> turns away the overflow");
+    ft::queue<int, ft::ring_buffer<int, 4> > ft_rqueue;
+    ft_rqueue.push_range(seq, seq + 4);
+    ft_rqueue.pop();
+    ft_rqueue.push(42);
+    std::cout << "queue<ring_buffer> front/back: " << ft_rqueue.front() << "/" << ft_rqueue.back() << std::endl;
     return 0;
 }
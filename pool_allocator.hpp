@@ -0,0 +1,293 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <limits>
+#include <utility>
+
+namespace ft
+{
+
+    // Hands out fixed-size chunks carved from large slabs. Freed chunks go on
+    // an intrusive free list and are reused before the slab is bumped again;
+    // slabs only go back to the system in release() or the destructor.
+    class node_pool
+    {
+        struct free_chunk
+        {
+            free_chunk *next;
+        };
+
+        struct slab_header
+        {
+            slab_header *next;
+            std::max_align_t pad;
+        };
+
+        std::size_t _chunk_size;
+        std::size_t _chunks_per_slab;
+        free_chunk *_free;
+        char *_bump;
+        char *_bump_end;
+        slab_header *_slabs;
+
+        node_pool(const node_pool &);
+        node_pool &operator=(const node_pool &);
+
+        void _grow()
+        {
+            std::size_t offset = offsetof(slab_header, pad);
+            slab_header *slab = static_cast<slab_header *>(
+                ::operator new(offset + _chunk_size * _chunks_per_slab));
+            slab->next = _slabs;
+            _slabs = slab;
+            _bump = reinterpret_cast<char *>(slab) + offset;
+            _bump_end = _bump + _chunk_size * _chunks_per_slab;
+        }
+
+    public:
+        node_pool() : _chunk_size(0), _chunks_per_slab(0), _free(NULL),
+                      _bump(NULL), _bump_end(NULL), _slabs(NULL) {}
+
+        ~node_pool()
+        {
+            release();
+        }
+
+        void init(std::size_t chunk_size, std::size_t chunks_per_slab)
+        {
+            _chunk_size = chunk_size;
+            _chunks_per_slab = chunks_per_slab;
+        }
+
+        void *allocate()
+        {
+            if (_free)
+            {
+                free_chunk *chunk = _free;
+                _free = chunk->next;
+                return chunk;
+            }
+            if (_bump == _bump_end)
+                _grow();
+            void *p = _bump;
+            _bump += _chunk_size;
+            return p;
+        }
+
+        void deallocate(void *p)
+        {
+            free_chunk *chunk = static_cast<free_chunk *>(p);
+            chunk->next = _free;
+            _free = chunk;
+        }
+
+        void release()
+        {
+            while (_slabs)
+            {
+                slab_header *next = _slabs->next;
+                ::operator delete(_slabs);
+                _slabs = next;
+            }
+            _free = NULL;
+            _bump = _bump_end = NULL;
+        }
+    };
+
+    // A set of node_pools, one per size class of alignof(max_align_t) bytes.
+    // Requests above the largest class go straight to operator new. Not
+    // synchronized: share one resource only between containers used from the
+    // same thread.
+    class pool_resource
+    {
+    public:
+        static const std::size_t granularity = alignof(std::max_align_t);
+        static const std::size_t size_classes = 16;
+        static const std::size_t max_pooled_size = granularity * size_classes;
+
+    private:
+        node_pool _pools[size_classes];
+
+        pool_resource(const pool_resource &);
+        pool_resource &operator=(const pool_resource &);
+
+    public:
+        explicit pool_resource(std::size_t slab_bytes = 16384)
+        {
+            for (std::size_t i = 0; i < size_classes; ++i)
+            {
+                std::size_t chunk = (i + 1) * granularity;
+                std::size_t per_slab = slab_bytes / chunk;
+                _pools[i].init(chunk, per_slab < 8 ? 8 : per_slab);
+            }
+        }
+
+        void *allocate(std::size_t bytes)
+        {
+            if (bytes == 0 || bytes > max_pooled_size)
+                return ::operator new(bytes);
+            return _pools[(bytes - 1) / granularity].allocate();
+        }
+
+        void deallocate(void *p, std::size_t bytes)
+        {
+            if (bytes == 0 || bytes > max_pooled_size)
+                ::operator delete(p);
+            else
+                _pools[(bytes - 1) / granularity].deallocate(p);
+        }
+
+        // Frees every slab at once. Only valid once nothing allocated from
+        // the pools is still in use.
+        void release()
+        {
+            for (std::size_t i = 0; i < size_classes; ++i)
+                _pools[i].release();
+        }
+    };
+
+    // Allocator over a pool_resource, meant for node-based containers.
+    // A default-constructed allocator creates its own resource on first use,
+    // so each container gets a private pool; constructing containers from a
+    // pool_allocator built with share() makes them draw from one pool.
+    template <typename T>
+    class pool_allocator
+    {
+    public:
+        typedef T value_type;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef pool_allocator<U> other;
+        };
+
+    private:
+        template <typename U>
+        friend class pool_allocator;
+
+        std::shared_ptr<pool_resource> _resource;
+
+    public:
+        pool_allocator() {}
+
+        explicit pool_allocator(const std::shared_ptr<pool_resource> &resource)
+            : _resource(resource) {}
+
+        template <typename U>
+        pool_allocator(const pool_allocator<U> &other)
+            : _resource(other._resource) {}
+
+        static pool_allocator share(std::size_t slab_bytes = 16384)
+        {
+            return pool_allocator(std::make_shared<pool_resource>(slab_bytes));
+        }
+
+        pointer allocate(size_type n)
+        {
+            if (n > max_size())
+                throw std::bad_alloc();
+            if (!_resource)
+                _resource = std::make_shared<pool_resource>();
+            return static_cast<pointer>(_resource->allocate(n * sizeof(T)));
+        }
+
+        void deallocate(pointer p, size_type n)
+        {
+            _resource->deallocate(p, n * sizeof(T));
+        }
+
+        template <class U, class... Args>
+        void construct(U *p, Args &&...args)
+        {
+            ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+        }
+
+        template <class U>
+        void destroy(U *p)
+        {
+            p->~U();
+        }
+
+        size_type max_size() const
+        {
+            return std::numeric_limits<size_type>::max() / sizeof(T);
+        }
+
+        // True when no other allocator shares this one's resource, so the
+        // owner may drop every node at once with release().
+        bool owns_pool() const
+        {
+            return _resource && _resource.use_count() == 1;
+        }
+
+        void release()
+        {
+            if (_resource)
+                _resource->release();
+        }
+
+        const std::shared_ptr<pool_resource> &resource() const
+        {
+            return _resource;
+        }
+    };
+
+    // Lets a node container ask any allocator whether it may drop all of
+    // its nodes at once. Only a pool_allocator that is the sole owner of its
+    // resource says yes; every other allocator falls back to freeing nodes
+    // one by one.
+    template <class A>
+    struct pool_traits
+    {
+    private:
+        template <class B>
+        static auto _owns(const B &a, int) -> decltype(a.owns_pool())
+        {
+            return a.owns_pool();
+        }
+        template <class B>
+        static bool _owns(const B &, long)
+        {
+            return false;
+        }
+        template <class B>
+        static auto _release(B &a, int) -> decltype(a.release())
+        {
+            a.release();
+        }
+        template <class B>
+        static void _release(B &, long) {}
+
+    public:
+        static bool owns_pool(const A &a)
+        {
+            return _owns(a, 0);
+        }
+        static void release(A &a)
+        {
+            _release(a, 0);
+        }
+    };
+
+    template <typename T, typename U>
+    bool operator==(const pool_allocator<T> &lhs, const pool_allocator<U> &rhs)
+    {
+        return lhs.resource() == rhs.resource();
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const pool_allocator<T> &lhs, const pool_allocator<U> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <utility>
+
+#include "deque.hpp"
+#include "container_adapter.hpp"
+
+namespace ft
+{
+
+    // A FIFO over any container with front, back, push_back, emplace_back
+    // and pop_front: ft::deque by default, or ft::list or ft::ring_buffer.
+    // ft::vector has no pop_front, so it cannot back a queue.
+    template <typename T, class Container = ft::deque<T>>
+    class queue
+    {
+    public:
+        typedef Container container_type;
+        typedef typename Container::value_type value_type;
+        typedef typename Container::size_type size_type;
+        typedef typename Container::reference reference;
+        typedef typename Container::const_reference const_reference;
+
+    protected:
+        container_type c;
+
+    public:
+        queue() : c() {}
+        explicit queue(const container_type &cont) : c(cont) {}
+        explicit queue(container_type &&cont) : c(std::move(cont)) {}
+
+        bool empty() const { return c.empty(); }
+        size_type size() const { return c.size(); }
+
+        reference front() { return c.front(); }
+        const_reference front() const { return c.front(); }
+        reference back() { return c.back(); }
+        const_reference back() const { return c.back(); }
+
+        // These return whatever the container's push_back does: the bool
+        // of an ft::ring_buffer that may turn elements away, else nothing.
+        auto push(const value_type &val) -> decltype(c.push_back(val)) { return c.push_back(val); }
+        auto push(value_type &&val) -> decltype(c.push_back(std::move(val)))
+        {
+            return c.push_back(std::move(val));
+        }
+
+        template <class... Args>
+        auto emplace(Args &&...args) -> decltype(c.emplace_back(std::forward<Args>(args)...))
+        {
+            return c.emplace_back(std::forward<Args>(args)...);
+        }
+
+        // Pushes [first, last) in order, so *first leaves before *(last - 1).
+        template <class InputIt>
+        void push_range(InputIt first, InputIt last) { adapter_append(c, first, last); }
+
+        // Removes the front element and hands it back by move.
+        value_type pop()
+        {
+            value_type front(std::move(c.front()));
+            c.pop_front();
+            return front;
+        }
+
+        void swap(queue &other) { c.swap(other.c); }
+
+        template <typename T1, class C1>
+        friend bool operator==(const queue<T1, C1> &lhs, const queue<T1, C1> &rhs);
+        template <typename T1, class C1>
+        friend bool operator<(const queue<T1, C1> &lhs, const queue<T1, C1> &rhs);
+    };
+
+    template <typename T, class Container>
+    bool operator==(const queue<T, Container> &lhs, const queue<T, Container> &rhs)
+    {
+        return lhs.c == rhs.c;
+    }
+
+    template <typename T, class Container>
+    bool operator!=(const queue<T, Container> &lhs, const queue<T, Container> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename T, class Container>
+    bool operator<(const queue<T, Container> &lhs, const queue<T, Container> &rhs)
+    {
+        return lhs.c < rhs.c;
+    }
+
+    template <typename T, class Container>
+    bool operator>(const queue<T, Container> &lhs, const queue<T, Container> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename T, class Container>
+    bool operator<=(const queue<T, Container> &lhs, const queue<T, Container> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename T, class Container>
+    bool operator>=(const queue<T, Container> &lhs, const queue<T, Container> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename T, class Container>
+    void swap(queue<T, Container> &lhs, queue<T, Container> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+}
@@ -0,0 +1,1044 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "pool_allocator.hpp"
+
+namespace ft
+{
+
+    enum rb_color
+    {
+        rb_red,
+        rb_black
+    };
+
+    // Links shared by every tree node and by the header. The header is red,
+    // its parent is the root and its left/right point at the leftmost and
+    // rightmost nodes, so begin() and --end() are O(1). An empty tree's
+    // header points left and right at itself.
+    struct rb_node_base
+    {
+        rb_color color;
+        rb_node_base *parent;
+        rb_node_base *left;
+        rb_node_base *right;
+
+        static rb_node_base *minimum(rb_node_base *x)
+        {
+            while (x->left)
+                x = x->left;
+            return x;
+        }
+
+        static rb_node_base *maximum(rb_node_base *x)
+        {
+            while (x->right)
+                x = x->right;
+            return x;
+        }
+    };
+
+    inline rb_node_base *rb_increment(rb_node_base *x)
+    {
+        if (x->right)
+            return rb_node_base::minimum(x->right);
+        rb_node_base *y = x->parent;
+        while (x == y->right)
+        {
+            x = y;
+            y = y->parent;
+        }
+        // Stepping past the rightmost node climbs to the header; the root's
+        // parent is the header, whose right is that node again.
+        if (x->right != y)
+            x = y;
+        return x;
+    }
+
+    inline rb_node_base *rb_decrement(rb_node_base *x)
+    {
+        if (x->color == rb_red && x->parent->parent == x)
+            return x->right;
+        if (x->left)
+            return rb_node_base::maximum(x->left);
+        rb_node_base *y = x->parent;
+        while (x == y->left)
+        {
+            x = y;
+            y = y->parent;
+        }
+        return y;
+    }
+
+    inline void rb_rotate_left(rb_node_base *x, rb_node_base *&root)
+    {
+        rb_node_base *y = x->right;
+        x->right = y->left;
+        if (y->left)
+            y->left->parent = x;
+        y->parent = x->parent;
+        if (x == root)
+            root = y;
+        else if (x == x->parent->left)
+            x->parent->left = y;
+        else
+            x->parent->right = y;
+        y->left = x;
+        x->parent = y;
+    }
+
+    inline void rb_rotate_right(rb_node_base *x, rb_node_base *&root)
+    {
+        rb_node_base *y = x->left;
+        x->left = y->right;
+        if (y->right)
+            y->right->parent = x;
+        y->parent = x->parent;
+        if (x == root)
+            root = y;
+        else if (x == x->parent->right)
+            x->parent->right = y;
+        else
+            x->parent->left = y;
+        y->right = x;
+        x->parent = y;
+    }
+
+    // Links x as a child of p and restores the red-black invariants.
+    inline void rb_insert_and_rebalance(bool insert_left, rb_node_base *x,
+                                        rb_node_base *p, rb_node_base &header)
+    {
+        rb_node_base *&root = header.parent;
+
+        x->parent = p;
+        x->left = x->right = nullptr;
+        x->color = rb_red;
+
+        if (insert_left)
+        {
+            p->left = x;
+            if (p == &header)
+            {
+                header.parent = x;
+                header.right = x;
+            }
+            else if (p == header.left)
+                header.left = x;
+        }
+        else
+        {
+            p->right = x;
+            if (p == header.right)
+                header.right = x;
+        }
+
+        while (x != root && x->parent->color == rb_red)
+        {
+            rb_node_base *xpp = x->parent->parent;
+            if (x->parent == xpp->left)
+            {
+                rb_node_base *y = xpp->right;
+                if (y && y->color == rb_red)
+                {
+                    x->parent->color = rb_black;
+                    y->color = rb_black;
+                    xpp->color = rb_red;
+                    x = xpp;
+                }
+                else
+                {
+                    if (x == x->parent->right)
+                    {
+                        x = x->parent;
+                        rb_rotate_left(x, root);
+                    }
+                    x->parent->color = rb_black;
+                    xpp->color = rb_red;
+                    rb_rotate_right(xpp, root);
+                }
+            }
+            else
+            {
+                rb_node_base *y = xpp->left;
+                if (y && y->color == rb_red)
+                {
+                    x->parent->color = rb_black;
+                    y->color = rb_black;
+                    xpp->color = rb_red;
+                    x = xpp;
+                }
+                else
+                {
+                    if (x == x->parent->left)
+                    {
+                        x = x->parent;
+                        rb_rotate_right(x, root);
+                    }
+                    x->parent->color = rb_black;
+                    xpp->color = rb_red;
+                    rb_rotate_left(xpp, root);
+                }
+            }
+        }
+        root->color = rb_black;
+    }
+
+    // Unlinks z, restores the invariants and returns z for the caller to free.
+    inline rb_node_base *rb_rebalance_for_erase(rb_node_base *z, rb_node_base &header)
+    {
+        rb_node_base *&root = header.parent;
+        rb_node_base *&leftmost = header.left;
+        rb_node_base *&rightmost = header.right;
+        rb_node_base *y = z;
+        rb_node_base *x = nullptr;
+        rb_node_base *x_parent = nullptr;
+
+        if (!y->left)
+            x = y->right;
+        else if (!y->right)
+            x = y->left;
+        else
+        {
+            y = rb_node_base::minimum(y->right);
+            x = y->right;
+        }
+
+        if (y != z)
+        {
+            // z has two children: splice its successor y into its place.
+            z->left->parent = y;
+            y->left = z->left;
+            if (y != z->right)
+            {
+                x_parent = y->parent;
+                if (x)
+                    x->parent = y->parent;
+                y->parent->left = x;
+                y->right = z->right;
+                z->right->parent = y;
+            }
+            else
+                x_parent = y;
+            if (root == z)
+                root = y;
+            else if (z->parent->left == z)
+                z->parent->left = y;
+            else
+                z->parent->right = y;
+            y->parent = z->parent;
+            std::swap(y->color, z->color);
+            y = z;
+        }
+        else
+        {
+            x_parent = y->parent;
+            if (x)
+                x->parent = y->parent;
+            if (root == z)
+                root = x;
+            else if (z->parent->left == z)
+                z->parent->left = x;
+            else
+                z->parent->right = x;
+            if (leftmost == z)
+                leftmost = z->right ? rb_node_base::minimum(x) : z->parent;
+            if (rightmost == z)
+                rightmost = z->left ? rb_node_base::maximum(x) : z->parent;
+        }
+
+        if (y->color != rb_red)
+        {
+            while (x != root && (!x || x->color == rb_black))
+            {
+                if (x == x_parent->left)
+                {
+                    rb_node_base *w = x_parent->right;
+                    if (w->color == rb_red)
+                    {
+                        w->color = rb_black;
+                        x_parent->color = rb_red;
+                        rb_rotate_left(x_parent, root);
+                        w = x_parent->right;
+                    }
+                    if ((!w->left || w->left->color == rb_black) &&
+                        (!w->right || w->right->color == rb_black))
+                    {
+                        w->color = rb_red;
+                        x = x_parent;
+                        x_parent = x_parent->parent;
+                    }
+                    else
+                    {
+                        if (!w->right || w->right->color == rb_black)
+                        {
+                            w->left->color = rb_black;
+                            w->color = rb_red;
+                            rb_rotate_right(w, root);
+                            w = x_parent->right;
+                        }
+                        w->color = x_parent->color;
+                        x_parent->color = rb_black;
+                        if (w->right)
+                            w->right->color = rb_black;
+                        rb_rotate_left(x_parent, root);
+                        break;
+                    }
+                }
+                else
+                {
+                    rb_node_base *w = x_parent->left;
+                    if (w->color == rb_red)
+                    {
+                        w->color = rb_black;
+                        x_parent->color = rb_red;
+                        rb_rotate_right(x_parent, root);
+                        w = x_parent->left;
+                    }
+                    if ((!w->right || w->right->color == rb_black) &&
+                        (!w->left || w->left->color == rb_black))
+                    {
+                        w->color = rb_red;
+                        x = x_parent;
+                        x_parent = x_parent->parent;
+                    }
+                    else
+                    {
+                        if (!w->left || w->left->color == rb_black)
+                        {
+                            w->right->color = rb_black;
+                            w->color = rb_red;
+                            rb_rotate_left(w, root);
+                            w = x_parent->left;
+                        }
+                        w->color = x_parent->color;
+                        x_parent->color = rb_black;
+                        if (w->left)
+                            w->left->color = rb_black;
+                        rb_rotate_right(x_parent, root);
+                        break;
+                    }
+                }
+            }
+            if (x)
+                x->color = rb_black;
+        }
+        return y;
+    }
+
+    struct rb_identity
+    {
+        template <class V>
+        const V &operator()(const V &v) const { return v; }
+    };
+
+    struct rb_select_first
+    {
+        template <class P>
+        const typename P::first_type &operator()(const P &p) const { return p.first; }
+    };
+
+    // The ordered tree behind ft::map, ft::set, ft::multimap and ft::multiset.
+    // KeyOfValue pulls the key out of a stored Value. Nodes come from Alloc
+    // rebound to the node type, so a pool_allocator pools them like ft::list.
+    template <class Key, class Value, class KeyOfValue, class Compare,
+              class Alloc = std::allocator<Value>>
+    class rb_tree
+    {
+    public:
+        typedef Key key_type;
+        typedef Value value_type;
+        typedef Compare key_compare;
+        typedef Alloc allocator_type;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef value_type &reference;
+        typedef const value_type &const_reference;
+        typedef value_type *pointer;
+        typedef const value_type *const_pointer;
+
+    private:
+        // Keeps the forwarding constructor from hijacking Node's copy.
+        struct construct_tag
+        {
+        };
+
+        struct Node : rb_node_base
+        {
+            value_type value;
+
+            template <class... Args>
+            Node(construct_tag, Args &&...args)
+                : rb_node_base(), value(std::forward<Args>(args)...) {}
+        };
+        typedef typename Alloc::template rebind<Node>::other node_allocator;
+
+        rb_node_base _header;
+        size_type _size;
+        key_compare _comp;
+        allocator_type _alloc;
+        node_allocator node_alloc;
+        // Nodes harvested by copy assignment, reused before allocating.
+        rb_node_base *_spare;
+
+        static const key_type &_key(const rb_node_base *x)
+        {
+            return KeyOfValue()(static_cast<const Node *>(x)->value);
+        }
+
+        rb_node_base *&_root() { return _header.parent; }
+        rb_node_base *_root() const { return _header.parent; }
+
+        void _init_empty()
+        {
+            _header.color = rb_red;
+            _header.parent = nullptr;
+            _header.left = _header.right = &_header;
+            _size = 0;
+        }
+
+        template <class... Args>
+        Node *_create_node(Args &&...args)
+        {
+            Node *node;
+            if (_spare)
+            {
+                node = static_cast<Node *>(_spare);
+                _spare = _spare->right;
+            }
+            else
+                node = node_alloc.allocate(1);
+            try
+            {
+                node_alloc.construct(node, construct_tag(), std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                node_alloc.deallocate(node, 1);
+                throw;
+            }
+            return node;
+        }
+
+        void _destroy_node(rb_node_base *x)
+        {
+            node_alloc.destroy(static_cast<Node *>(x));
+            node_alloc.deallocate(static_cast<Node *>(x), 1);
+        }
+
+        // Recurses right and loops left, so the stack depth is the height.
+        void _erase_subtree(rb_node_base *x)
+        {
+            while (x)
+            {
+                _erase_subtree(x->right);
+                rb_node_base *left = x->left;
+                _destroy_node(x);
+                x = left;
+            }
+        }
+
+        void _destroy_values(rb_node_base *x)
+        {
+            while (x)
+            {
+                _destroy_values(x->right);
+                rb_node_base *left = x->left;
+                node_alloc.destroy(static_cast<Node *>(x));
+                x = left;
+            }
+        }
+
+        void _stash_subtree(rb_node_base *x)
+        {
+            while (x)
+            {
+                _stash_subtree(x->right);
+                rb_node_base *left = x->left;
+                node_alloc.destroy(static_cast<Node *>(x));
+                x->right = _spare;
+                _spare = x;
+                x = left;
+            }
+        }
+
+        void _free_spares()
+        {
+            while (_spare)
+            {
+                rb_node_base *next = _spare->right;
+                node_alloc.deallocate(static_cast<Node *>(_spare), 1);
+                _spare = next;
+            }
+        }
+
+        Node *_clone(const rb_node_base *x)
+        {
+            Node *node = _create_node(static_cast<const Node *>(x)->value);
+            node->color = x->color;
+            node->left = node->right = nullptr;
+            return node;
+        }
+
+        rb_node_base *_copy(const rb_node_base *x, rb_node_base *p)
+        {
+            rb_node_base *top = _clone(x);
+            top->parent = p;
+            try
+            {
+                if (x->right)
+                    top->right = _copy(x->right, top);
+                p = top;
+                x = x->left;
+                while (x)
+                {
+                    rb_node_base *y = _clone(x);
+                    p->left = y;
+                    y->parent = p;
+                    if (x->right)
+                        y->right = _copy(x->right, y);
+                    p = y;
+                    x = x->left;
+                }
+            }
+            catch (...)
+            {
+                _erase_subtree(top);
+                throw;
+            }
+            return top;
+        }
+
+        void _copy_from(const rb_tree &other)
+        {
+            if (!other._root())
+                return;
+            _root() = _copy(other._root(), &_header);
+            _header.left = rb_node_base::minimum(_root());
+            _header.right = rb_node_base::maximum(_root());
+            _size = other._size;
+        }
+
+        // Placement of a new key: {nullptr, parent} to link under parent,
+        // {node, parent} to force a left link, {existing, nullptr} when a
+        // unique tree already holds an equal key.
+        typedef std::pair<rb_node_base *, rb_node_base *> insert_pos;
+
+        insert_pos _unique_pos(const key_type &k)
+        {
+            rb_node_base *x = _root();
+            rb_node_base *y = &_header;
+            bool left = true;
+            while (x)
+            {
+                y = x;
+                left = _comp(k, _key(x));
+                x = left ? x->left : x->right;
+            }
+            rb_node_base *j = y;
+            if (left)
+            {
+                if (j == _header.left)
+                    return insert_pos(nullptr, y);
+                j = rb_decrement(j);
+            }
+            if (_comp(_key(j), k))
+                return insert_pos(nullptr, y);
+            return insert_pos(j, nullptr);
+        }
+
+        insert_pos _equal_pos(const key_type &k)
+        {
+            rb_node_base *x = _root();
+            rb_node_base *y = &_header;
+            while (x)
+            {
+                y = x;
+                x = _comp(k, _key(x)) ? x->left : x->right;
+            }
+            return insert_pos(nullptr, y);
+        }
+
+        // Checks the hint and its neighbour first; input arriving in order
+        // with end() as the hint never descends from the root.
+        insert_pos _hint_unique_pos(rb_node_base *pos, const key_type &k)
+        {
+            if (pos == &_header)
+            {
+                if (_size > 0 && _comp(_key(_header.right), k))
+                    return insert_pos(nullptr, _header.right);
+                return _unique_pos(k);
+            }
+            if (_comp(k, _key(pos)))
+            {
+                if (pos == _header.left)
+                    return insert_pos(pos, pos);
+                rb_node_base *before = rb_decrement(pos);
+                if (_comp(_key(before), k))
+                    return before->right ? insert_pos(pos, pos) : insert_pos(nullptr, before);
+                return _unique_pos(k);
+            }
+            if (_comp(_key(pos), k))
+            {
+                if (pos == _header.right)
+                    return insert_pos(nullptr, pos);
+                rb_node_base *after = rb_increment(pos);
+                if (_comp(k, _key(after)))
+                    return pos->right ? insert_pos(after, after) : insert_pos(nullptr, pos);
+                return _unique_pos(k);
+            }
+            return insert_pos(pos, nullptr);
+        }
+
+        insert_pos _hint_equal_pos(rb_node_base *pos, const key_type &k)
+        {
+            if (pos == &_header)
+            {
+                if (_size > 0 && !_comp(k, _key(_header.right)))
+                    return insert_pos(nullptr, _header.right);
+                return _equal_pos(k);
+            }
+            if (!_comp(_key(pos), k))
+            {
+                if (pos == _header.left)
+                    return insert_pos(pos, pos);
+                rb_node_base *before = rb_decrement(pos);
+                if (!_comp(k, _key(before)))
+                    return before->right ? insert_pos(pos, pos) : insert_pos(nullptr, before);
+                return _equal_pos(k);
+            }
+            if (pos == _header.right)
+                return insert_pos(nullptr, pos);
+            rb_node_base *after = rb_increment(pos);
+            if (!_comp(_key(after), k))
+                return pos->right ? insert_pos(after, after) : insert_pos(nullptr, pos);
+            return _equal_pos(k);
+        }
+
+        rb_node_base *_link(insert_pos pos, rb_node_base *node)
+        {
+            bool left = pos.first || pos.second == &_header || _comp(_key(node), _key(pos.second));
+            rb_insert_and_rebalance(left, node, pos.second, _header);
+            ++_size;
+            return node;
+        }
+
+        rb_node_base *_lower_bound(const key_type &k) const
+        {
+            rb_node_base *x = _header.parent;
+            rb_node_base *y = const_cast<rb_node_base *>(&_header);
+            while (x)
+            {
+                if (!_comp(_key(x), k))
+                {
+                    y = x;
+                    x = x->left;
+                }
+                else
+                    x = x->right;
+            }
+            return y;
+        }
+
+        rb_node_base *_upper_bound(const key_type &k) const
+        {
+            rb_node_base *x = _header.parent;
+            rb_node_base *y = const_cast<rb_node_base *>(&_header);
+            while (x)
+            {
+                if (_comp(k, _key(x)))
+                {
+                    y = x;
+                    x = x->left;
+                }
+                else
+                    x = x->right;
+            }
+            return y;
+        }
+
+    public:
+        class iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef Value value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef Value *pointer;
+            typedef Value &reference;
+
+            iterator() : _node(nullptr) {}
+            explicit iterator(rb_node_base *n) : _node(n) {}
+
+            reference operator*() const { return static_cast<Node *>(_node)->value; }
+            pointer operator->() const { return &static_cast<Node *>(_node)->value; }
+
+            iterator &operator++()
+            {
+                _node = rb_increment(_node);
+                return *this;
+            }
+            iterator operator++(int)
+            {
+                iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+            iterator &operator--()
+            {
+                _node = rb_decrement(_node);
+                return *this;
+            }
+            iterator operator--(int)
+            {
+                iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const iterator &other) const { return _node == other._node; }
+            bool operator!=(const iterator &other) const { return _node != other._node; }
+
+            rb_node_base *base() const { return _node; }
+
+        private:
+            rb_node_base *_node;
+        };
+
+        class const_iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef Value value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const Value *pointer;
+            typedef const Value &reference;
+
+            const_iterator() : _node(nullptr) {}
+            explicit const_iterator(const rb_node_base *n) : _node(const_cast<rb_node_base *>(n)) {}
+            const_iterator(const iterator &other) : _node(other.base()) {}
+
+            reference operator*() const { return static_cast<Node *>(_node)->value; }
+            pointer operator->() const { return &static_cast<Node *>(_node)->value; }
+
+            const_iterator &operator++()
+            {
+                _node = rb_increment(_node);
+                return *this;
+            }
+            const_iterator operator++(int)
+            {
+                const_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+            const_iterator &operator--()
+            {
+                _node = rb_decrement(_node);
+                return *this;
+            }
+            const_iterator operator--(int)
+            {
+                const_iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const const_iterator &other) const { return _node == other._node; }
+            bool operator!=(const const_iterator &other) const { return _node != other._node; }
+
+            rb_node_base *base() const { return _node; }
+
+        private:
+            rb_node_base *_node;
+        };
+
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        explicit rb_tree(const key_compare &comp = key_compare(),
+                         const allocator_type &alloc = allocator_type())
+            : _comp(comp), _alloc(alloc), node_alloc(alloc), _spare(nullptr)
+        {
+            _init_empty();
+        }
+
+        rb_tree(const rb_tree &other)
+            : _comp(other._comp), _alloc(other._alloc), node_alloc(other._alloc), _spare(nullptr)
+        {
+            _init_empty();
+            _copy_from(other);
+        }
+
+        rb_tree(rb_tree &&other)
+            : _comp(other._comp), _alloc(other._alloc), node_alloc(other.node_alloc), _spare(nullptr)
+        {
+            _init_empty();
+            swap(other);
+        }
+
+        // Reuses this tree's nodes for the copy before allocating new ones.
+        rb_tree &operator=(const rb_tree &other)
+        {
+            if (this == &other)
+                return *this;
+            _stash_subtree(_root());
+            _init_empty();
+            _comp = other._comp;
+            try
+            {
+                _copy_from(other);
+            }
+            catch (...)
+            {
+                _free_spares();
+                throw;
+            }
+            _free_spares();
+            return *this;
+        }
+
+        rb_tree &operator=(rb_tree &&other)
+        {
+            if (this != &other)
+            {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~rb_tree()
+        {
+            clear();
+        }
+
+        iterator begin() { return iterator(_header.left); }
+        const_iterator begin() const { return const_iterator(_header.left); }
+        iterator end() { return iterator(&_header); }
+        const_iterator end() const { return const_iterator(&_header); }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        bool empty() const { return _size == 0; }
+        size_type size() const { return _size; }
+        size_type max_size() const { return node_alloc.max_size(); }
+        key_compare key_comp() const { return _comp; }
+        allocator_type get_allocator() const { return _alloc; }
+
+        void clear()
+        {
+            if (pool_traits<node_allocator>::owns_pool(node_alloc))
+            {
+                if (!std::is_trivially_destructible<value_type>::value)
+                    _destroy_values(_root());
+                pool_traits<node_allocator>::release(node_alloc);
+            }
+            else
+                _erase_subtree(_root());
+            _init_empty();
+        }
+
+        void swap(rb_tree &other)
+        {
+            std::swap(_header.parent, other._header.parent);
+            std::swap(_header.left, other._header.left);
+            std::swap(_header.right, other._header.right);
+            std::swap(_size, other._size);
+            if (_header.parent)
+                _header.parent->parent = &_header;
+            else
+                _header.left = _header.right = &_header;
+            if (other._header.parent)
+                other._header.parent->parent = &other._header;
+            else
+                other._header.left = other._header.right = &other._header;
+            std::swap(_comp, other._comp);
+            std::swap(_alloc, other._alloc);
+            std::swap(node_alloc, other.node_alloc);
+        }
+
+        template <class V>
+        std::pair<iterator, bool> insert_unique(V &&v)
+        {
+            insert_pos pos = _unique_pos(KeyOfValue()(v));
+            if (!pos.second)
+                return std::pair<iterator, bool>(iterator(pos.first), false);
+            return std::pair<iterator, bool>(iterator(_link(pos, _create_node(std::forward<V>(v)))), true);
+        }
+
+        template <class V>
+        iterator insert_unique(const_iterator hint, V &&v)
+        {
+            insert_pos pos = _hint_unique_pos(hint.base(), KeyOfValue()(v));
+            if (!pos.second)
+                return iterator(pos.first);
+            return iterator(_link(pos, _create_node(std::forward<V>(v))));
+        }
+
+        template <class V>
+        iterator insert_equal(V &&v)
+        {
+            insert_pos pos = _equal_pos(KeyOfValue()(v));
+            return iterator(_link(pos, _create_node(std::forward<V>(v))));
+        }
+
+        template <class V>
+        iterator insert_equal(const_iterator hint, V &&v)
+        {
+            insert_pos pos = _hint_equal_pos(hint.base(), KeyOfValue()(v));
+            return iterator(_link(pos, _create_node(std::forward<V>(v))));
+        }
+
+        // Ranges are inserted with end() as the hint, so sorted input costs
+        // amortized O(1) per element.
+        template <class InputIt>
+        void insert_range_unique(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                insert_unique(end(), *first);
+        }
+
+        template <class InputIt>
+        void insert_range_equal(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                insert_equal(end(), *first);
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> emplace_unique(Args &&...args)
+        {
+            Node *node = _create_node(std::forward<Args>(args)...);
+            insert_pos pos = _unique_pos(_key(node));
+            if (!pos.second)
+            {
+                _destroy_node(node);
+                return std::pair<iterator, bool>(iterator(pos.first), false);
+            }
+            return std::pair<iterator, bool>(iterator(_link(pos, node)), true);
+        }
+
+        template <class... Args>
+        iterator emplace_hint_unique(const_iterator hint, Args &&...args)
+        {
+            Node *node = _create_node(std::forward<Args>(args)...);
+            insert_pos pos = _hint_unique_pos(hint.base(), _key(node));
+            if (!pos.second)
+            {
+                _destroy_node(node);
+                return iterator(pos.first);
+            }
+            return iterator(_link(pos, node));
+        }
+
+        template <class... Args>
+        iterator emplace_equal(Args &&...args)
+        {
+            Node *node = _create_node(std::forward<Args>(args)...);
+            return iterator(_link(_equal_pos(_key(node)), node));
+        }
+
+        template <class... Args>
+        iterator emplace_hint_equal(const_iterator hint, Args &&...args)
+        {
+            Node *node = _create_node(std::forward<Args>(args)...);
+            return iterator(_link(_hint_equal_pos(hint.base(), _key(node)), node));
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            rb_node_base *node = pos.base();
+            rb_node_base *next = rb_increment(node);
+            _destroy_node(rb_rebalance_for_erase(node, _header));
+            --_size;
+            return iterator(next);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            if (first == begin() && last == end())
+            {
+                clear();
+                return end();
+            }
+            while (first != last)
+                first = erase(first);
+            return iterator(last.base());
+        }
+
+        size_type erase(const key_type &k)
+        {
+            std::pair<iterator, iterator> range = equal_range(k);
+            size_type old_size = _size;
+            erase(range.first, range.second);
+            return old_size - _size;
+        }
+
+        iterator find(const key_type &k)
+        {
+            iterator it = lower_bound(k);
+            return it == end() || _comp(k, _key(it.base())) ? end() : it;
+        }
+        const_iterator find(const key_type &k) const
+        {
+            const_iterator it = lower_bound(k);
+            return it == end() || _comp(k, _key(it.base())) ? end() : it;
+        }
+
+        size_type count(const key_type &k) const
+        {
+            std::pair<const_iterator, const_iterator> range = equal_range(k);
+            return std::distance(range.first, range.second);
+        }
+
+        iterator lower_bound(const key_type &k)
+        {
+            return iterator(_lower_bound(k));
+        }
+        const_iterator lower_bound(const key_type &k) const
+        {
+            return const_iterator(_lower_bound(k));
+        }
+
+        iterator upper_bound(const key_type &k)
+        {
+            return iterator(_upper_bound(k));
+        }
+        const_iterator upper_bound(const key_type &k) const
+        {
+            return const_iterator(_upper_bound(k));
+        }
+
+        std::pair<iterator, iterator> equal_range(const key_type &k)
+        {
+            return std::pair<iterator, iterator>(lower_bound(k), upper_bound(k));
+        }
+        std::pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+        {
+            return std::pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k));
+        }
+    };
+
+    // Element-wise comparisons shared by the tree adapters.
+    template <class Container>
+    bool rb_equal(const Container &lhs, const Container &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class Container>
+    bool rb_less(const Container &lhs, const Container &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+}
@@ -0,0 +1,625 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ft
+{
+
+    // What a full ring_buffer does with one more element: ring_reject keeps
+    // what it holds and push_back returns false, ring_overwrite drops the
+    // oldest element to make room.
+    struct ring_reject
+    {
+        static const bool overwrite = false;
+    };
+
+    struct ring_overwrite
+    {
+        static const bool overwrite = true;
+    };
+
+    // Capacity argument for a ring_buffer sized at run time.
+    const std::size_t dynamic_capacity = 0;
+
+    // Slots of a ring_buffer. A compile-time capacity lives inline and its
+    // mask is a constant folded into every index.
+    template <typename T, std::size_t N, class Alloc>
+    class ring_storage
+    {
+        static_assert((N & (N - 1)) == 0, "ring_buffer capacity must be a power of two");
+
+        typename std::aligned_storage<sizeof(T) * N, std::alignment_of<T>::value>::type _buffer;
+
+    public:
+        static const bool is_inline = true;
+
+        void allocate(Alloc &, std::size_t) {}
+        void deallocate(Alloc &) {}
+
+        T *data() { return reinterpret_cast<T *>(&_buffer); }
+        const T *data() const { return reinterpret_cast<const T *>(&_buffer); }
+        std::size_t capacity() const { return N; }
+        std::size_t mask() const { return N - 1; }
+    };
+
+    // A run-time capacity is rounded up to a power of two and allocated
+    // once; a default-constructed buffer has no slots at all.
+    template <typename T, class Alloc>
+    class ring_storage<T, dynamic_capacity, Alloc>
+    {
+        T *_data;
+        std::size_t _capacity;
+
+    public:
+        static const bool is_inline = false;
+
+        ring_storage() : _data(nullptr), _capacity(0) {}
+
+        void allocate(Alloc &alloc, std::size_t capacity)
+        {
+            if (!capacity)
+                return;
+            std::size_t rounded = 1;
+            while (rounded < capacity)
+                rounded *= 2;
+            _data = alloc.allocate(rounded);
+            _capacity = rounded;
+        }
+
+        void deallocate(Alloc &alloc)
+        {
+            if (_data)
+                alloc.deallocate(_data, _capacity);
+            _data = nullptr;
+            _capacity = 0;
+        }
+
+        void swap(ring_storage &other)
+        {
+            std::swap(_data, other._data);
+            std::swap(_capacity, other._capacity);
+        }
+
+        T *data() { return _data; }
+        const T *data() const { return _data; }
+        std::size_t capacity() const { return _capacity; }
+        std::size_t mask() const { return _capacity ? _capacity - 1 : 0; }
+    };
+
+    // A bounded FIFO over a power-of-two slot array. Head and tail are
+    // free-running counters masked on access, so a push is one masked store
+    // and a bounds check against the capacity, never a block switch. The
+    // elements form at most two contiguous segments, which bulk append and
+    // drain copy with memcpy when T allows it. N is the capacity, or
+    // dynamic_capacity to take it from the constructor.
+    template <typename T, std::size_t N = dynamic_capacity, class Overflow = ring_reject,
+              class Alloc = std::allocator<T>>
+    class ring_buffer
+    {
+    public:
+        typedef T value_type;
+        typedef Alloc allocator_type;
+        typedef Overflow overflow_policy;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        // A contiguous run of slots: where it starts and how many it holds.
+        typedef std::pair<pointer, size_type> segment;
+        typedef std::pair<const_pointer, size_type> const_segment;
+
+    private:
+        template <class V>
+        class basic_iterator
+        {
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef V *pointer;
+            typedef V &reference;
+
+            basic_iterator() : _data(nullptr), _mask(0), _pos(0) {}
+            basic_iterator(V *data, size_type mask, size_type pos) : _data(data), _mask(mask), _pos(pos) {}
+            template <class Other>
+            basic_iterator(const basic_iterator<Other> &other,
+                           typename std::enable_if<std::is_convertible<Other *, V *>::value>::type * = 0)
+                : _data(other._data), _mask(other._mask), _pos(other._pos) {}
+
+            reference operator*() const { return _data[_pos & _mask]; }
+            pointer operator->() const { return _data + (_pos & _mask); }
+            reference operator[](difference_type n) const { return _data[(_pos + n) & _mask]; }
+
+            basic_iterator &operator++()
+            {
+                ++_pos;
+                return *this;
+            }
+            basic_iterator operator++(int)
+            {
+                basic_iterator tmp(*this);
+                ++_pos;
+                return tmp;
+            }
+            basic_iterator &operator--()
+            {
+                --_pos;
+                return *this;
+            }
+            basic_iterator operator--(int)
+            {
+                basic_iterator tmp(*this);
+                --_pos;
+                return tmp;
+            }
+            basic_iterator &operator+=(difference_type n)
+            {
+                _pos += n;
+                return *this;
+            }
+            basic_iterator &operator-=(difference_type n) { return *this += -n; }
+            basic_iterator operator+(difference_type n) const { return basic_iterator(_data, _mask, _pos + n); }
+            basic_iterator operator-(difference_type n) const { return basic_iterator(_data, _mask, _pos - n); }
+            friend basic_iterator operator+(difference_type n, const basic_iterator &it) { return it + n; }
+
+            // Positions are free-running counters, so they compare by their
+            // distance, which stays right when the counters wrap.
+            template <class Other>
+            difference_type operator-(const basic_iterator<Other> &other) const
+            {
+                return static_cast<difference_type>(_pos - other._pos);
+            }
+            template <class Other>
+            bool operator==(const basic_iterator<Other> &other) const { return _pos == other._pos; }
+            template <class Other>
+            bool operator!=(const basic_iterator<Other> &other) const { return _pos != other._pos; }
+            template <class Other>
+            bool operator<(const basic_iterator<Other> &other) const { return *this - other < 0; }
+            template <class Other>
+            bool operator>(const basic_iterator<Other> &other) const { return other < *this; }
+            template <class Other>
+            bool operator<=(const basic_iterator<Other> &other) const { return !(other < *this); }
+            template <class Other>
+            bool operator>=(const basic_iterator<Other> &other) const { return !(*this < other); }
+
+        private:
+            template <class>
+            friend class basic_iterator;
+
+            V *_data;
+            size_type _mask;
+            size_type _pos;
+        };
+
+    public:
+        typedef basic_iterator<T> iterator;
+        typedef basic_iterator<const T> const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    private:
+        typedef ring_storage<T, N, Alloc> storage_type;
+
+        storage_type _store;
+        size_type _head;
+        size_type _tail;
+        allocator_type _alloc;
+
+        typedef std::integral_constant<bool, std::is_trivially_copyable<T>::value>
+            bitwise_copyable;
+
+        template <class It>
+        struct copies_bitwise
+            : std::integral_constant<bool,
+                                     bitwise_copyable::value && std::is_pointer<It>::value &&
+                                         std::is_same<typename std::remove_cv<
+                                                          typename std::remove_pointer<It>::type>::type,
+                                                      T>::value>
+        {
+        };
+
+        pointer _slot(size_type i) { return _store.data() + (i & _store.mask()); }
+        const_pointer _slot(size_type i) const { return _store.data() + (i & _store.mask()); }
+
+        // The part of [from, from + n) that runs up to the end of the array,
+        // and the part that wraps to its start.
+        segment _first_run(size_type from, size_type n)
+        {
+            size_type offset = from & _store.mask();
+            return segment(_store.data() + offset, std::min(n, capacity() - offset));
+        }
+        segment _second_run(size_type from, size_type n)
+        {
+            return segment(_store.data(), n - _first_run(from, n).second);
+        }
+
+        // Constructs n elements at dst from src and returns src advanced past
+        // them; on failure the elements built so far are destroyed.
+        template <class It>
+        It construct_block(pointer dst, It src, size_type n, std::true_type)
+        {
+            if (n)
+                std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src),
+                            n * sizeof(T));
+            return src + n;
+        }
+
+        template <class It>
+        It construct_block(pointer dst, It src, size_type n, std::false_type)
+        {
+            size_type i = 0;
+            try
+            {
+                for (; i < n; ++i, ++src)
+                    _alloc.construct(dst + i, *src);
+            }
+            catch (...)
+            {
+                destroy_block(dst, i);
+                throw;
+            }
+            return src;
+        }
+
+        void destroy_block(pointer p, size_type n)
+        {
+            if (!std::is_trivially_destructible<T>::value)
+                for (size_type i = 0; i < n; ++i)
+                    _alloc.destroy(p + i);
+        }
+
+        template <class OutputIt>
+        OutputIt move_block(pointer src, size_type n, OutputIt out, std::true_type)
+        {
+            if (n)
+                std::memcpy(static_cast<void *>(out), static_cast<const void *>(src),
+                            n * sizeof(T));
+            return out + n;
+        }
+
+        template <class OutputIt>
+        OutputIt move_block(pointer src, size_type n, OutputIt out, std::false_type)
+        {
+            return std::move(src, src + n, out);
+        }
+
+        template <class InputIt>
+        size_type append_range(InputIt first, InputIt last, std::input_iterator_tag)
+        {
+            size_type added = 0;
+            for (; first != last && push_back(*first); ++first)
+                ++added;
+            return added;
+        }
+
+        // Makes room first, then fills the free slots as at most two blocks.
+        template <class ForwardIt>
+        size_type append_range(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+        {
+            size_type n = std::distance(first, last);
+            if (Overflow::overwrite)
+            {
+                if (n > capacity())
+                {
+                    std::advance(first, n - capacity());
+                    n = capacity();
+                }
+                if (n > capacity() - size())
+                    pop_front_n(n - (capacity() - size()));
+            }
+            else if (n > capacity() - size())
+                n = capacity() - size();
+            segment one = _first_run(_tail, n);
+            first = construct_block(one.first, first, one.second, copies_bitwise<ForwardIt>());
+            _tail += one.second;
+            segment two = _second_run(_tail - one.second, n);
+            construct_block(two.first, first, two.second, copies_bitwise<ForwardIt>());
+            _tail += two.second;
+            return n;
+        }
+
+        void _copy_from(const ring_buffer &other)
+        {
+            for (size_type i = other._head; i != other._tail; ++i)
+            {
+                _alloc.construct(_slot(_tail), *other._slot(i));
+                ++_tail;
+            }
+        }
+
+        void _move_from(ring_buffer &other, std::true_type)
+        {
+            _store.swap(other._store);
+            std::swap(_head, other._head);
+            std::swap(_tail, other._tail);
+        }
+
+        void _move_from(ring_buffer &other, std::false_type)
+        {
+            for (size_type i = other._head; i != other._tail; ++i)
+            {
+                _alloc.construct(_slot(_tail), std::move(*other._slot(i)));
+                ++_tail;
+            }
+            other.clear();
+        }
+
+        typedef std::integral_constant<bool, !storage_type::is_inline> steals_storage;
+
+        void _swap(ring_buffer &other, std::true_type)
+        {
+            _move_from(other, std::true_type());
+            std::swap(_alloc, other._alloc);
+        }
+
+        // Inline slots cannot change hands, so the elements move instead.
+        void _swap(ring_buffer &other, std::false_type)
+        {
+            ring_buffer tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+    public:
+        explicit ring_buffer(const allocator_type &alloc = allocator_type())
+            : _head(0), _tail(0), _alloc(alloc) {}
+
+        // Only for dynamic_capacity; rounds capacity up to a power of two.
+        explicit ring_buffer(size_type capacity, const allocator_type &alloc = allocator_type())
+            : _head(0), _tail(0), _alloc(alloc)
+        {
+            static_assert(N == dynamic_capacity, "fixed-capacity ring_buffer takes no capacity");
+            _store.allocate(_alloc, capacity);
+        }
+
+        ring_buffer(const ring_buffer &other)
+            : _head(0), _tail(0), _alloc(other._alloc)
+        {
+            _store.allocate(_alloc, other.capacity());
+            try
+            {
+                _copy_from(other);
+            }
+            catch (...)
+            {
+                clear();
+                _store.deallocate(_alloc);
+                throw;
+            }
+        }
+
+        ring_buffer(ring_buffer &&other)
+            : _head(0), _tail(0), _alloc(other._alloc)
+        {
+            if (storage_type::is_inline)
+                _store.allocate(_alloc, other.capacity());
+            _move_from(other, steals_storage());
+        }
+
+        ring_buffer &operator=(const ring_buffer &other)
+        {
+            if (this != &other)
+            {
+                ring_buffer tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        ring_buffer &operator=(ring_buffer &&other)
+        {
+            if (this != &other)
+            {
+                clear();
+                if (!storage_type::is_inline)
+                    _store.deallocate(_alloc);
+                _head = _tail = 0;
+                _move_from(other, steals_storage());
+            }
+            return *this;
+        }
+
+        ~ring_buffer()
+        {
+            clear();
+            _store.deallocate(_alloc);
+        }
+
+        iterator begin() { return iterator(_store.data(), _store.mask(), _head); }
+        const_iterator begin() const { return const_iterator(_store.data(), _store.mask(), _head); }
+        iterator end() { return iterator(_store.data(), _store.mask(), _tail); }
+        const_iterator end() const { return const_iterator(_store.data(), _store.mask(), _tail); }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        size_type size() const { return _tail - _head; }
+        size_type capacity() const { return _store.capacity(); }
+        size_type max_size() const { return capacity(); }
+        bool empty() const { return _tail == _head; }
+        bool full() const { return size() == capacity(); }
+        allocator_type get_allocator() const { return _alloc; }
+
+        reference front() { return *_slot(_head); }
+        const_reference front() const { return *_slot(_head); }
+        reference back() { return *_slot(_tail - 1); }
+        const_reference back() const { return *_slot(_tail - 1); }
+
+        reference operator[](size_type n) { return *_slot(_head + n); }
+        const_reference operator[](size_type n) const { return *_slot(_head + n); }
+
+        reference at(size_type n)
+        {
+            if (n >= size())
+                throw std::out_of_range("ring_buffer::at");
+            return (*this)[n];
+        }
+        const_reference at(size_type n) const
+        {
+            if (n >= size())
+                throw std::out_of_range("ring_buffer::at");
+            return (*this)[n];
+        }
+
+        // Returns false when a full ring_reject buffer turns the element
+        // away. A full ring_overwrite buffer builds the element before it
+        // drops the oldest, so args may refer to that element.
+        template <class... Args>
+        bool emplace_back(Args &&...args)
+        {
+            if (size() == capacity())
+            {
+                if (!Overflow::overwrite || !capacity())
+                    return false;
+                value_type tmp(std::forward<Args>(args)...);
+                _alloc.destroy(_slot(_head));
+                ++_head;
+                _alloc.construct(_slot(_tail), std::move(tmp));
+                ++_tail;
+                return true;
+            }
+            _alloc.construct(_slot(_tail), std::forward<Args>(args)...);
+            ++_tail;
+            return true;
+        }
+
+        bool push_back(const value_type &val) { return emplace_back(val); }
+        bool push_back(value_type &&val) { return emplace_back(std::move(val)); }
+
+        void pop_front()
+        {
+            if (empty())
+                throw std::out_of_range("ring_buffer::pop_front");
+            _alloc.destroy(_slot(_head));
+            ++_head;
+        }
+
+        void pop_back()
+        {
+            if (empty())
+                throw std::out_of_range("ring_buffer::pop_back");
+            --_tail;
+            _alloc.destroy(_slot(_tail));
+        }
+
+        void pop_front_n(size_type n)
+        {
+            if (n > size())
+                throw std::out_of_range("ring_buffer::pop_front_n");
+            segment one = _first_run(_head, n);
+            destroy_block(one.first, one.second);
+            destroy_block(_store.data(), n - one.second);
+            _head += n;
+        }
+
+        void clear()
+        {
+            pop_front_n(size());
+            _head = _tail = 0;
+        }
+
+        // Appends [first, last) and returns how many elements went in. A
+        // ring_reject buffer stops when full; a ring_overwrite buffer keeps
+        // the newest capacity() elements of the old contents and the range.
+        template <class InputIt>
+        size_type append(InputIt first, InputIt last)
+        {
+            return append_range(first, last,
+                                typename std::iterator_traits<InputIt>::iterator_category());
+        }
+
+        // Moves up to n elements from the front into out, removes them and
+        // returns out advanced past the last element written.
+        template <class OutputIt>
+        OutputIt drain_front(size_type n, OutputIt out)
+        {
+            if (n > size())
+                n = size();
+            segment one = _first_run(_head, n);
+            out = move_block(one.first, one.second, out, copies_bitwise<OutputIt>());
+            out = move_block(_store.data(), n - one.second, out, copies_bitwise<OutputIt>());
+            pop_front_n(n);
+            return out;
+        }
+
+        // The elements as two contiguous segments, oldest first; the second
+        // is empty unless the contents wrap past the end of the array.
+        const_segment first_segment() const
+        {
+            size_type offset = _head & _store.mask();
+            return const_segment(_store.data() + offset, std::min(size(), capacity() - offset));
+        }
+        const_segment second_segment() const
+        {
+            return const_segment(_store.data(), size() - first_segment().second);
+        }
+
+        // The free slots after back() as two segments, for writing elements
+        // of a trivially copyable T in place before commit_back publishes
+        // them.
+        segment first_free_segment() { return _first_run(_tail, capacity() - size()); }
+        segment second_free_segment() { return _second_run(_tail, capacity() - size()); }
+
+        void commit_back(size_type n)
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                          "commit_back needs a trivially copyable element type");
+            _tail += n;
+        }
+
+        void swap(ring_buffer &other) { _swap(other, steals_storage()); }
+    };
+
+    template <typename T, std::size_t N, class Overflow, class Alloc>
+    bool operator==(const ring_buffer<T, N, Overflow, Alloc> &lhs, const ring_buffer<T, N, Overflow, Alloc> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename T, std::size_t N, class Overflow, class Alloc>
+    bool operator!=(const ring_buffer<T, N, Overflow, Alloc> &lhs, const ring_buffer<T, N, Overflow, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename T, std::size_t N, class Overflow, class Alloc>
+    bool operator<(const ring_buffer<T, N, Overflow, Alloc> &lhs, const ring_buffer<T, N, Overflow, Alloc> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, std::size_t N, class Overflow, class Alloc>
+    bool operator>(const ring_buffer<T, N, Overflow, Alloc> &lhs, const ring_buffer<T, N, Overflow, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename T, std::size_t N, class Overflow, class Alloc>
+    bool operator<=(const ring_buffer<T, N, Overflow, Alloc> &lhs, const ring_buffer<T, N, Overflow, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename T, std::size_t N, class Overflow, class Alloc>
+    bool operator>=(const ring_buffer<T, N, Overflow, Alloc> &lhs, const ring_buffer<T, N, Overflow, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename T, std::size_t N, class Overflow, class Alloc>
+    void swap(ring_buffer<T, N, Overflow, Alloc> &lhs, ring_buffer<T, N, Overflow, Alloc> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+}
@@ -0,0 +1,228 @@
+#ifndef FT_SMALL_VECTOR_HPP
+#define FT_SMALL_VECTOR_HPP
+
+#include <memory>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "vector.hpp"
+
+namespace ft
+{
+
+    template <typename T, std::size_t N>
+    struct small_vector_arena
+    {
+        typename std::aligned_storage<sizeof(T) * N,
+                                      std::alignment_of<T>::value>::type buffer;
+        bool in_use;
+
+        small_vector_arena() : in_use(false) {}
+
+        T *storage()
+        {
+            return reinterpret_cast<T *>(&buffer);
+        }
+        const T *storage() const
+        {
+            return reinterpret_cast<const T *>(&buffer);
+        }
+    };
+
+    // Hands out the owning small_vector's inline arena for the first request
+    // that fits, and forwards everything else to Alloc.
+    template <typename T, std::size_t N, class Alloc = std::allocator<T>>
+    class small_buffer_allocator
+    {
+    public:
+        typedef T value_type;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef small_vector_arena<T, N> arena_type;
+
+    private:
+        arena_type *_arena;
+        Alloc _alloc;
+
+    public:
+        explicit small_buffer_allocator(arena_type *arena = NULL,
+                                        const Alloc &alloc = Alloc())
+            : _arena(arena), _alloc(alloc) {}
+
+        pointer allocate(size_type n)
+        {
+            if (_arena && !_arena->in_use && n <= N)
+            {
+                _arena->in_use = true;
+                return _arena->storage();
+            }
+            return _alloc.allocate(n);
+        }
+
+        void deallocate(pointer p, size_type n)
+        {
+            if (_arena && p == _arena->storage())
+                _arena->in_use = false;
+            else
+                _alloc.deallocate(p, n);
+        }
+
+        template <class U, class... Args>
+        void construct(U *p, Args &&...args)
+        {
+            ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+        }
+
+        template <class U>
+        void destroy(U *p)
+        {
+            p->~U();
+        }
+
+        size_type max_size() const
+        {
+            return _alloc.max_size();
+        }
+
+        // The allocator behind the arena, for handing on to a copy.
+        const Alloc &upstream() const
+        {
+            return _alloc;
+        }
+    };
+
+    // A vector that keeps up to N elements inside the object and only spills
+    // to Alloc once it outgrows them. Everything but construction, moves and
+    // swap is inherited from ft::vector.
+    template <typename T, std::size_t N, class Alloc = std::allocator<T>,
+              class Growth = grow_one_and_half>
+    class small_vector
+        : private small_vector_arena<T, N>,
+          public vector<T, small_buffer_allocator<T, N, Alloc>, Growth>
+    {
+        static_assert(N > 0, "small_vector needs at least one inline slot");
+
+        typedef small_vector_arena<T, N> arena_type;
+        typedef vector<T, small_buffer_allocator<T, N, Alloc>, Growth> base_type;
+
+    public:
+        typedef typename base_type::value_type value_type;
+        typedef typename base_type::allocator_type allocator_type;
+        typedef typename base_type::size_type size_type;
+        typedef typename base_type::iterator iterator;
+        typedef typename base_type::const_iterator const_iterator;
+
+        static const size_type inline_capacity = N;
+
+    private:
+        // Takes other's elements, stealing its heap buffer when it has one
+        // and this object's upstream allocator can free it.
+        void _take(small_vector &other)
+        {
+            if (other.is_inline() ||
+                this->get_allocator().upstream() != other.get_allocator().upstream())
+            {
+                this->assign(std::make_move_iterator(other.begin()),
+                             std::make_move_iterator(other.end()));
+                other.clear();
+            }
+            else
+            {
+                this->_steal_buffer(other);
+                other.reserve(N);
+            }
+        }
+
+    public:
+        explicit small_vector(const Alloc &alloc = Alloc())
+            : arena_type(), base_type(allocator_type(this, alloc))
+        {
+            this->reserve(N);
+        }
+
+        explicit small_vector(size_type n, const value_type &val = value_type(),
+                              const Alloc &alloc = Alloc())
+            : arena_type(), base_type(allocator_type(this, alloc))
+        {
+            this->reserve(N);
+            this->assign(n, val);
+        }
+
+        template <class InputIt>
+        small_vector(InputIt first, InputIt last, const Alloc &alloc = Alloc(),
+                     typename std::enable_if<!std::is_integral<InputIt>::value>::type * = 0)
+            : arena_type(), base_type(allocator_type(this, alloc))
+        {
+            this->reserve(N);
+            this->assign(first, last);
+        }
+
+        small_vector(const small_vector &other)
+            : arena_type(), base_type(allocator_type(this, other.get_allocator().upstream()))
+        {
+            this->reserve(N);
+            this->assign(other.begin(), other.end());
+        }
+
+        small_vector(small_vector &&other) noexcept(std::is_nothrow_move_constructible<T>::value)
+            : arena_type(), base_type(allocator_type(this, other.get_allocator().upstream()))
+        {
+            if (other.is_inline())
+                this->reserve(N);
+            _take(other);
+        }
+
+        small_vector &operator=(const small_vector &other)
+        {
+            if (this != &other)
+                this->assign(other.begin(), other.end());
+            return *this;
+        }
+
+        small_vector &operator=(small_vector &&other) noexcept(std::is_empty<Alloc>::value &&
+                                                              std::is_nothrow_move_constructible<T>::value &&
+                                                              std::is_nothrow_move_assignable<T>::value)
+        {
+            if (this != &other)
+                _take(other);
+            return *this;
+        }
+
+        void swap(small_vector &other)
+        {
+            small_vector tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+        // Never leaves the arena, and comes back to it once the elements fit.
+        void shrink_to_fit()
+        {
+            if (is_inline())
+                return;
+            if (this->size() <= N)
+                this->_rebuffer(N);
+            else
+                base_type::shrink_to_fit();
+        }
+
+        bool is_inline() const
+        {
+            return this->data() == arena_type::storage();
+        }
+    };
+
+    template <typename T, std::size_t N, class Alloc, class Growth>
+    const typename small_vector<T, N, Alloc, Growth>::size_type
+        small_vector<T, N, Alloc, Growth>::inline_capacity;
+
+}
+
+#endif
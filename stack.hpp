@@ -0,0 +1,114 @@
+#pragma once
+
+#include <utility>
+
+#include "deque.hpp"
+#include "container_adapter.hpp"
+
+namespace ft
+{
+
+    // A LIFO over any container with back, push_back, emplace_back and
+    // pop_back: ft::deque by default, or ft::vector, ft::list or
+    // ft::ring_buffer. Every call forwards straight to the container.
+    template <typename T, class Container = ft::deque<T>>
+    class stack
+    {
+    public:
+        typedef Container container_type;
+        typedef typename Container::value_type value_type;
+        typedef typename Container::size_type size_type;
+        typedef typename Container::reference reference;
+        typedef typename Container::const_reference const_reference;
+
+    protected:
+        container_type c;
+
+    public:
+        stack() : c() {}
+        explicit stack(const container_type &cont) : c(cont) {}
+        explicit stack(container_type &&cont) : c(std::move(cont)) {}
+
+        bool empty() const { return c.empty(); }
+        size_type size() const { return c.size(); }
+
+        reference top() { return c.back(); }
+        const_reference top() const { return c.back(); }
+
+        // These return whatever the container's push_back does: the bool
+        // of an ft::ring_buffer that may turn elements away, else nothing.
+        auto push(const value_type &val) -> decltype(c.push_back(val)) { return c.push_back(val); }
+        auto push(value_type &&val) -> decltype(c.push_back(std::move(val)))
+        {
+            return c.push_back(std::move(val));
+        }
+
+        template <class... Args>
+        auto emplace(Args &&...args) -> decltype(c.emplace_back(std::forward<Args>(args)...))
+        {
+            return c.emplace_back(std::forward<Args>(args)...);
+        }
+
+        // Pushes [first, last) in order, so *(last - 1) ends up on top.
+        template <class InputIt>
+        void push_range(InputIt first, InputIt last) { adapter_append(c, first, last); }
+
+        // Removes the top element and hands it back by move.
+        value_type pop()
+        {
+            value_type top(std::move(c.back()));
+            c.pop_back();
+            return top;
+        }
+
+        void swap(stack &other) { c.swap(other.c); }
+
+        template <typename T1, class C1>
+        friend bool operator==(const stack<T1, C1> &lhs, const stack<T1, C1> &rhs);
+        template <typename T1, class C1>
+        friend bool operator<(const stack<T1, C1> &lhs, const stack<T1, C1> &rhs);
+    };
+
+    template <typename T, class Container>
+    bool operator==(const stack<T, Container> &lhs, const stack<T, Container> &rhs)
+    {
+        return lhs.c == rhs.c;
+    }
+
+    template <typename T, class Container>
+    bool operator!=(const stack<T, Container> &lhs, const stack<T, Container> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename T, class Container>
+    bool operator<(const stack<T, Container> &lhs, const stack<T, Container> &rhs)
+    {
+        return lhs.c < rhs.c;
+    }
+
+    template <typename T, class Container>
+    bool operator>(const stack<T, Container> &lhs, const stack<T, Container> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename T, class Container>
+    bool operator<=(const stack<T, Container> &lhs, const stack<T, Container> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename T, class Container>
+    bool operator>=(const stack<T, Container> &lhs, const stack<T, Container> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename T, class Container>
+    void swap(stack<T, Container> &lhs, stack<T, Container> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "hash_table.hpp"
+
+namespace ft
+{
+
+    // A hash map over ft::hash_table. Entries live in one flat slot array,
+    // so references and iterators are invalidated by any insert that grows
+    // the table and by erase, which may shift later entries of a run back.
+    template <typename Key, typename T, class Hash = std::hash<Key>,
+              class KeyEqual = std::equal_to<Key>,
+              class Alloc = std::allocator<std::pair<const Key, T>>>
+    class unordered_map
+    {
+    public:
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef std::pair<const Key, T> value_type;
+        typedef Hash hasher;
+        typedef KeyEqual key_equal;
+        typedef Alloc allocator_type;
+
+    private:
+        typedef hash_table<key_type, value_type, rb_select_first, hasher, key_equal, allocator_type> table_type;
+        table_type _table;
+
+        // Lookup overloads taking any key type, for transparent Hash and
+        // KeyEqual only.
+        template <class K>
+        using _if_transparent = typename std::enable_if<hash_is_transparent<Hash, KeyEqual>::value, K>::type;
+
+    public:
+        typedef typename table_type::size_type size_type;
+        typedef typename table_type::difference_type difference_type;
+        typedef typename table_type::reference reference;
+        typedef typename table_type::const_reference const_reference;
+        typedef typename table_type::pointer pointer;
+        typedef typename table_type::const_pointer const_pointer;
+        typedef typename table_type::iterator iterator;
+        typedef typename table_type::const_iterator const_iterator;
+
+        explicit unordered_map(size_type bucket_count = 0, const hasher &hash = hasher(),
+                               const key_equal &eq = key_equal(),
+                               const allocator_type &alloc = allocator_type())
+            : _table(bucket_count, hash, eq, alloc) {}
+
+        template <class InputIt>
+        unordered_map(InputIt first, InputIt last, size_type bucket_count = 0,
+                      const hasher &hash = hasher(), const key_equal &eq = key_equal(),
+                      const allocator_type &alloc = allocator_type())
+            : _table(bucket_count, hash, eq, alloc)
+        {
+            _table.insert_range_unique(first, last);
+        }
+
+        unordered_map(std::initializer_list<value_type> il, size_type bucket_count = 0,
+                      const hasher &hash = hasher(), const key_equal &eq = key_equal(),
+                      const allocator_type &alloc = allocator_type())
+            : _table(bucket_count, hash, eq, alloc)
+        {
+            _table.insert_range_unique(il.begin(), il.end());
+        }
+
+        iterator begin() { return _table.begin(); }
+        const_iterator begin() const { return _table.begin(); }
+        iterator end() { return _table.end(); }
+        const_iterator end() const { return _table.end(); }
+
+        bool empty() const { return _table.empty(); }
+        size_type size() const { return _table.size(); }
+        size_type max_size() const { return _table.max_size(); }
+
+        mapped_type &operator[](const key_type &k)
+        {
+            return _table.emplace_key(k, std::piecewise_construct, std::forward_as_tuple(k),
+                                      std::tuple<>())
+                .first->second;
+        }
+
+        mapped_type &operator[](key_type &&k)
+        {
+            return _table.emplace_key(k, std::piecewise_construct, std::forward_as_tuple(std::move(k)),
+                                      std::tuple<>())
+                .first->second;
+        }
+
+        mapped_type &at(const key_type &k)
+        {
+            iterator it = _table.find(k);
+            if (it == end())
+                throw std::out_of_range("unordered_map::at");
+            return it->second;
+        }
+        const mapped_type &at(const key_type &k) const
+        {
+            const_iterator it = _table.find(k);
+            if (it == end())
+                throw std::out_of_range("unordered_map::at");
+            return it->second;
+        }
+
+        std::pair<iterator, bool> insert(const value_type &val)
+        {
+            return _table.insert_unique(val);
+        }
+
+        std::pair<iterator, bool> insert(value_type &&val)
+        {
+            return _table.insert_unique(std::move(val));
+        }
+
+        // The hint is ignored; the key's hash already names its slot.
+        iterator insert(const_iterator, const value_type &val)
+        {
+            return _table.insert_unique(val).first;
+        }
+
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            _table.insert_range_unique(first, last);
+        }
+
+        void insert(std::initializer_list<value_type> il)
+        {
+            _table.insert_range_unique(il.begin(), il.end());
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args)
+        {
+            return _table.emplace_unique(std::forward<Args>(args)...);
+        }
+
+        // Builds the mapped value only when k is absent.
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(const key_type &k, Args &&...args)
+        {
+            return _table.emplace_key(k, std::piecewise_construct, std::forward_as_tuple(k),
+                                      std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        template <class M>
+        std::pair<iterator, bool> insert_or_assign(const key_type &k, M &&obj)
+        {
+            std::pair<iterator, bool> res = try_emplace(k, std::forward<M>(obj));
+            if (!res.second)
+                res.first->second = std::forward<M>(obj);
+            return res;
+        }
+
+        // Later entries may shift into pos, so the result can point at the
+        // same slot; erasing while iterating visits every entry once.
+        iterator erase(const_iterator pos) { return _table.erase(pos); }
+        iterator erase(iterator pos) { return _table.erase(pos); }
+        iterator erase(const_iterator first, const_iterator last) { return _table.erase(first, last); }
+        size_type erase(const key_type &k) { return _table.erase_key(k); }
+
+        template <class K, class = _if_transparent<K>>
+        size_type erase(const K &k) { return _table.erase_key(k); }
+
+        void swap(unordered_map &other) { _table.swap(other._table); }
+        void clear() { _table.clear(); }
+
+        iterator find(const key_type &k) { return _table.find(k); }
+        const_iterator find(const key_type &k) const { return _table.find(k); }
+        size_type count(const key_type &k) const { return _table.count(k); }
+        bool contains(const key_type &k) const { return _table.count(k) != 0; }
+
+        template <class K, class = _if_transparent<K>>
+        iterator find(const K &k) { return _table.find(k); }
+        template <class K, class = _if_transparent<K>>
+        const_iterator find(const K &k) const { return _table.find(k); }
+        template <class K, class = _if_transparent<K>>
+        size_type count(const K &k) const { return _table.count(k); }
+        template <class K, class = _if_transparent<K>>
+        bool contains(const K &k) const { return _table.count(k) != 0; }
+
+        std::pair<iterator, iterator> equal_range(const key_type &k)
+        {
+            iterator it = find(k);
+            return std::pair<iterator, iterator>(it, it == end() ? it : std::next(it));
+        }
+        std::pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+        {
+            const_iterator it = find(k);
+            return std::pair<const_iterator, const_iterator>(it, it == end() ? it : std::next(it));
+        }
+
+        size_type bucket_count() const { return _table.bucket_count(); }
+        float load_factor() const { return _table.load_factor(); }
+        float max_load_factor() const { return _table.max_load_factor(); }
+        void rehash(size_type n) { _table.rehash(n); }
+        void reserve(size_type n) { _table.reserve(n); }
+
+        hasher hash_function() const { return _table.hash_function(); }
+        key_equal key_eq() const { return _table.key_eq(); }
+        allocator_type get_allocator() const { return _table.get_allocator(); }
+    };
+
+    template <typename Key, typename T, class Hash, class KeyEqual, class Alloc>
+    bool operator==(const unordered_map<Key, T, Hash, KeyEqual, Alloc> &lhs,
+                    const unordered_map<Key, T, Hash, KeyEqual, Alloc> &rhs)
+    {
+        return hash_equal<rb_select_first>(lhs, rhs);
+    }
+
+    template <typename Key, typename T, class Hash, class KeyEqual, class Alloc>
+    bool operator!=(const unordered_map<Key, T, Hash, KeyEqual, Alloc> &lhs,
+                    const unordered_map<Key, T, Hash, KeyEqual, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Key, typename T, class Hash, class KeyEqual, class Alloc>
+    void swap(unordered_map<Key, T, Hash, KeyEqual, Alloc> &lhs,
+              unordered_map<Key, T, Hash, KeyEqual, Alloc> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "hash_table.hpp"
+
+namespace ft
+{
+
+    template <typename Key, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>,
+              class Alloc = std::allocator<Key>>
+    class unordered_set
+    {
+    public:
+        typedef Key key_type;
+        typedef Key value_type;
+        typedef Hash hasher;
+        typedef KeyEqual key_equal;
+        typedef Alloc allocator_type;
+
+    private:
+        typedef hash_table<key_type, value_type, rb_identity, hasher, key_equal, allocator_type> table_type;
+        table_type _table;
+
+        template <class K>
+        using _if_transparent = typename std::enable_if<hash_is_transparent<Hash, KeyEqual>::value, K>::type;
+
+    public:
+        typedef typename table_type::size_type size_type;
+        typedef typename table_type::difference_type difference_type;
+        typedef typename table_type::reference reference;
+        typedef typename table_type::const_reference const_reference;
+        typedef typename table_type::pointer pointer;
+        typedef typename table_type::const_pointer const_pointer;
+        // Keys are immutable in place, so both iterators are const.
+        typedef typename table_type::const_iterator iterator;
+        typedef typename table_type::const_iterator const_iterator;
+
+        explicit unordered_set(size_type bucket_count = 0, const hasher &hash = hasher(),
+                               const key_equal &eq = key_equal(),
+                               const allocator_type &alloc = allocator_type())
+            : _table(bucket_count, hash, eq, alloc) {}
+
+        template <class InputIt>
+        unordered_set(InputIt first, InputIt last, size_type bucket_count = 0,
+                      const hasher &hash = hasher(), const key_equal &eq = key_equal(),
+                      const allocator_type &alloc = allocator_type())
+            : _table(bucket_count, hash, eq, alloc)
+        {
+            _table.insert_range_unique(first, last);
+        }
+
+        unordered_set(std::initializer_list<value_type> il, size_type bucket_count = 0,
+                      const hasher &hash = hasher(), const key_equal &eq = key_equal(),
+                      const allocator_type &alloc = allocator_type())
+            : _table(bucket_count, hash, eq, alloc)
+        {
+            _table.insert_range_unique(il.begin(), il.end());
+        }
+
+        iterator begin() const { return _table.begin(); }
+        iterator end() const { return _table.end(); }
+
+        bool empty() const { return _table.empty(); }
+        size_type size() const { return _table.size(); }
+        size_type max_size() const { return _table.max_size(); }
+
+        std::pair<iterator, bool> insert(const value_type &val)
+        {
+            return _table.insert_unique(val);
+        }
+
+        std::pair<iterator, bool> insert(value_type &&val)
+        {
+            return _table.insert_unique(std::move(val));
+        }
+
+        iterator insert(const_iterator, const value_type &val)
+        {
+            return _table.insert_unique(val).first;
+        }
+
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            _table.insert_range_unique(first, last);
+        }
+
+        void insert(std::initializer_list<value_type> il)
+        {
+            _table.insert_range_unique(il.begin(), il.end());
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&...args)
+        {
+            return _table.emplace_unique(std::forward<Args>(args)...);
+        }
+
+        iterator erase(const_iterator pos) { return _table.erase(pos); }
+        iterator erase(const_iterator first, const_iterator last) { return _table.erase(first, last); }
+        size_type erase(const key_type &k) { return _table.erase_key(k); }
+
+        template <class K, class = _if_transparent<K>>
+        size_type erase(const K &k) { return _table.erase_key(k); }
+
+        void swap(unordered_set &other) { _table.swap(other._table); }
+        void clear() { _table.clear(); }
+
+        iterator find(const key_type &k) const { return _table.find(k); }
+        size_type count(const key_type &k) const { return _table.count(k); }
+        bool contains(const key_type &k) const { return _table.count(k) != 0; }
+
+        template <class K, class = _if_transparent<K>>
+        iterator find(const K &k) const { return _table.find(k); }
+        template <class K, class = _if_transparent<K>>
+        size_type count(const K &k) const { return _table.count(k); }
+        template <class K, class = _if_transparent<K>>
+        bool contains(const K &k) const { return _table.count(k) != 0; }
+
+        std::pair<iterator, iterator> equal_range(const key_type &k) const
+        {
+            iterator it = find(k);
+            return std::pair<iterator, iterator>(it, it == end() ? it : std::next(it));
+        }
+
+        size_type bucket_count() const { return _table.bucket_count(); }
+        float load_factor() const { return _table.load_factor(); }
+        float max_load_factor() const { return _table.max_load_factor(); }
+        void rehash(size_type n) { _table.rehash(n); }
+        void reserve(size_type n) { _table.reserve(n); }
+
+        hasher hash_function() const { return _table.hash_function(); }
+        key_equal key_eq() const { return _table.key_eq(); }
+        allocator_type get_allocator() const { return _table.get_allocator(); }
+    };
+
+    template <typename Key, class Hash, class KeyEqual, class Alloc>
+    bool operator==(const unordered_set<Key, Hash, KeyEqual, Alloc> &lhs,
+                    const unordered_set<Key, Hash, KeyEqual, Alloc> &rhs)
+    {
+        return hash_equal<rb_identity>(lhs, rhs);
+    }
+
+    template <typename Key, class Hash, class KeyEqual, class Alloc>
+    bool operator!=(const unordered_set<Key, Hash, KeyEqual, Alloc> &lhs,
+                    const unordered_set<Key, Hash, KeyEqual, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Key, class Hash, class KeyEqual, class Alloc>
+    void swap(unordered_set<Key, Hash, KeyEqual, Alloc> &lhs,
+              unordered_set<Key, Hash, KeyEqual, Alloc> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+}
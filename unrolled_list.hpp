@@ -0,0 +1,742 @@
+#pragma once
+
+#include <memory>
+#include <cstddef>
+#include <stdexcept>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "vector.hpp"
+
+namespace ft
+{
+    // Elements per unrolled_list node: as many as fit in NodeBytes, but never
+    // fewer than 4 so a node still amortizes its links.
+    template <typename T, std::size_t NodeBytes>
+    struct unrolled_node_capacity
+    {
+        static const std::size_t value = NodeBytes / sizeof(T) < 4 ? 4 : NodeBytes / sizeof(T);
+    };
+
+    // A doubly linked list of small element arrays. Scans walk each node's
+    // array sequentially, while whole lists still splice in at node
+    // boundaries without touching their elements. Inserting or erasing
+    // invalidates iterators into the affected node and its neighbours.
+    template <typename T, class Alloc = std::allocator<T>, std::size_t NodeBytes = 256>
+    class unrolled_list
+    {
+    public:
+        typedef T value_type;
+        typedef Alloc allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        static const size_type NODE_CAPACITY = unrolled_node_capacity<T, NodeBytes>::value;
+
+    private:
+        struct Node
+        {
+            Node *next;
+            Node *prev;
+            size_type count;
+            typename std::aligned_storage<sizeof(T) * NODE_CAPACITY,
+                                          std::alignment_of<T>::value>::type storage;
+
+            pointer elems() { return reinterpret_cast<pointer>(&storage); }
+        };
+        typedef typename Alloc::template rebind<Node>::other node_allocator;
+
+        Node *head;
+        Node *tail;
+        size_type sz;
+        allocator_type alloc;
+        node_allocator node_alloc;
+
+        Node *create_node()
+        {
+            Node *node = node_alloc.allocate(1);
+            node->next = node->prev = nullptr;
+            node->count = 0;
+            return node;
+        }
+
+        void link_after(Node *pos, Node *node)
+        {
+            node->prev = pos;
+            node->next = pos ? pos->next : head;
+            if (node->next)
+                node->next->prev = node;
+            else
+                tail = node;
+            if (pos)
+                pos->next = node;
+            else
+                head = node;
+        }
+
+        void unlink_node(Node *node)
+        {
+            if (node->prev)
+                node->prev->next = node->next;
+            else
+                head = node->next;
+            if (node->next)
+                node->next->prev = node->prev;
+            else
+                tail = node->prev;
+            node_alloc.deallocate(node, 1);
+        }
+
+        void destroy_range(pointer first, pointer last)
+        {
+            for (; first != last; ++first)
+                alloc.destroy(first);
+        }
+
+        // Moves node's elements from index at onwards into a fresh node
+        // linked right after it.
+        Node *split(Node *node, size_type at)
+        {
+            Node *rest = create_node();
+            pointer src = node->elems();
+            pointer dst = rest->elems();
+            size_type i = at;
+            try
+            {
+                for (; i < node->count; ++i)
+                    alloc.construct(dst + (i - at), std::move_if_noexcept(src[i]));
+            }
+            catch (...)
+            {
+                destroy_range(dst, dst + (i - at));
+                node_alloc.deallocate(rest, 1);
+                throw;
+            }
+            destroy_range(src + at, src + node->count);
+            rest->count = node->count - at;
+            node->count = at;
+            link_after(node, rest);
+            return rest;
+        }
+
+        // Places val at index at of a node that has a free slot.
+        template <class... Args>
+        void emplace_in_node(Node *node, size_type at, Args &&...args)
+        {
+            pointer e = node->elems();
+            if (at == node->count)
+            {
+                alloc.construct(e + at, std::forward<Args>(args)...);
+                ++node->count;
+                return;
+            }
+            value_type tmp(std::forward<Args>(args)...);
+            alloc.construct(e + node->count, std::move(e[node->count - 1]));
+            ++node->count;
+            std::move_backward(e + at, e + node->count - 2, e + node->count - 1);
+            e[at] = std::move(tmp);
+        }
+
+        // Pulls the following node's elements into node when both together
+        // fit in half a node, so erasures do not leave a trail of slivers.
+        void merge_next(Node *node)
+        {
+            Node *next = node->next;
+            if (!next || node->count + next->count > NODE_CAPACITY / 2)
+                return;
+            pointer dst = node->elems() + node->count;
+            pointer src = next->elems();
+            for (size_type i = 0; i < next->count; ++i)
+                alloc.construct(dst + i, std::move(src[i]));
+            destroy_range(src, src + next->count);
+            node->count += next->count;
+            unlink_node(next);
+        }
+
+        // Destroys everything from pos to the end of the list.
+        void truncate(Node *node, size_type at)
+        {
+            if (!node)
+                return;
+            Node *rest = node->next;
+            destroy_range(node->elems() + at, node->elems() + node->count);
+            sz -= node->count - at;
+            node->count = at;
+            while (rest)
+            {
+                Node *next = rest->next;
+                destroy_range(rest->elems(), rest->elems() + rest->count);
+                sz -= rest->count;
+                unlink_node(rest);
+                rest = next;
+            }
+            if (node->count == 0)
+                unlink_node(node);
+        }
+
+    public:
+        class const_iterator;
+
+        class iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef T *pointer;
+            typedef T &reference;
+
+            iterator() : node(nullptr), index(0) {}
+            iterator(Node *n, size_type i) : node(n), index(i) {}
+
+            reference operator*() const { return node->elems()[index]; }
+            pointer operator->() const { return node->elems() + index; }
+
+            iterator &operator++()
+            {
+                if (index + 1 < node->count || !node->next)
+                    ++index;
+                else
+                {
+                    node = node->next;
+                    index = 0;
+                }
+                return *this;
+            }
+            iterator operator++(int)
+            {
+                iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+            iterator &operator--()
+            {
+                if (index > 0)
+                    --index;
+                else
+                {
+                    node = node->prev;
+                    index = node->count - 1;
+                }
+                return *this;
+            }
+            iterator operator--(int)
+            {
+                iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const iterator &other) const
+            {
+                return node == other.node && index == other.index;
+            }
+            bool operator!=(const iterator &other) const
+            {
+                return !(*this == other);
+            }
+
+        private:
+            friend class unrolled_list;
+            friend class const_iterator;
+            Node *node;
+            size_type index;
+        };
+
+        class const_iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T *pointer;
+            typedef const T &reference;
+
+            const_iterator() : node(nullptr), index(0) {}
+            const_iterator(Node *n, size_type i) : node(n), index(i) {}
+            const_iterator(const iterator &other) : node(other.node), index(other.index) {}
+
+            reference operator*() const { return node->elems()[index]; }
+            pointer operator->() const { return node->elems() + index; }
+
+            const_iterator &operator++()
+            {
+                if (index + 1 < node->count || !node->next)
+                    ++index;
+                else
+                {
+                    node = node->next;
+                    index = 0;
+                }
+                return *this;
+            }
+            const_iterator operator++(int)
+            {
+                const_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+            const_iterator &operator--()
+            {
+                if (index > 0)
+                    --index;
+                else
+                {
+                    node = node->prev;
+                    index = node->count - 1;
+                }
+                return *this;
+            }
+            const_iterator operator--(int)
+            {
+                const_iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const const_iterator &other) const
+            {
+                return node == other.node && index == other.index;
+            }
+            bool operator!=(const const_iterator &other) const
+            {
+                return !(*this == other);
+            }
+
+        private:
+            friend class unrolled_list;
+            Node *node;
+            size_type index;
+        };
+
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        explicit unrolled_list(const allocator_type &a = allocator_type())
+            : head(nullptr), tail(nullptr), sz(0), alloc(a), node_alloc(a) {}
+
+        explicit unrolled_list(size_type n, const value_type &val = value_type(),
+                               const allocator_type &a = allocator_type())
+            : head(nullptr), tail(nullptr), sz(0), alloc(a), node_alloc(a)
+        {
+            try
+            {
+                for (size_type i = 0; i < n; ++i)
+                    push_back(val);
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        template <class InputIt>
+        unrolled_list(InputIt first, InputIt last, const allocator_type &a = allocator_type(),
+                      typename std::enable_if<!std::is_integral<InputIt>::value>::type * = 0)
+            : head(nullptr), tail(nullptr), sz(0), alloc(a), node_alloc(a)
+        {
+            try
+            {
+                append(first, last);
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        unrolled_list(const unrolled_list &other)
+            : head(nullptr), tail(nullptr), sz(0), alloc(other.alloc), node_alloc(other.node_alloc)
+        {
+            try
+            {
+                append(other.begin(), other.end());
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        unrolled_list(unrolled_list &&other) noexcept
+            : head(other.head), tail(other.tail), sz(other.sz),
+              alloc(other.alloc), node_alloc(other.node_alloc)
+        {
+            other.head = other.tail = nullptr;
+            other.sz = 0;
+        }
+
+        unrolled_list &operator=(const unrolled_list &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                append(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        unrolled_list &operator=(unrolled_list &&other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~unrolled_list()
+        {
+            clear();
+        }
+
+        iterator begin() { return iterator(head, 0); }
+        const_iterator begin() const { return const_iterator(head, 0); }
+        iterator end() { return iterator(tail, tail ? tail->count : 0); }
+        const_iterator end() const { return const_iterator(tail, tail ? tail->count : 0); }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        size_type size() const { return sz; }
+        bool empty() const { return sz == 0; }
+        size_type max_size() const { return alloc.max_size(); }
+        allocator_type get_allocator() const { return alloc; }
+
+        reference front()
+        {
+            if (empty())
+                throw std::out_of_range("unrolled_list is empty");
+            return head->elems()[0];
+        }
+        const_reference front() const
+        {
+            if (empty())
+                throw std::out_of_range("unrolled_list is empty");
+            return head->elems()[0];
+        }
+        reference back()
+        {
+            if (empty())
+                throw std::out_of_range("unrolled_list is empty");
+            return tail->elems()[tail->count - 1];
+        }
+        const_reference back() const
+        {
+            if (empty())
+                throw std::out_of_range("unrolled_list is empty");
+            return tail->elems()[tail->count - 1];
+        }
+
+        void clear()
+        {
+            truncate(head, 0);
+        }
+
+        template <class... Args>
+        void emplace_back(Args &&...args)
+        {
+            bool fresh = !tail || tail->count == NODE_CAPACITY;
+            if (fresh)
+                link_after(tail, create_node());
+            try
+            {
+                alloc.construct(tail->elems() + tail->count, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                if (fresh)
+                    unlink_node(tail);
+                throw;
+            }
+            ++tail->count;
+            ++sz;
+        }
+
+        template <class... Args>
+        void emplace_front(Args &&...args)
+        {
+            bool fresh = !head || head->count == NODE_CAPACITY;
+            if (fresh)
+                link_after(nullptr, create_node());
+            try
+            {
+                emplace_in_node(head, 0, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                if (fresh)
+                    unlink_node(head);
+                throw;
+            }
+            ++sz;
+        }
+
+        void push_back(const value_type &val) { emplace_back(val); }
+        void push_back(value_type &&val) { emplace_back(std::move(val)); }
+        void push_front(const value_type &val) { emplace_front(val); }
+        void push_front(value_type &&val) { emplace_front(std::move(val)); }
+
+        void pop_back()
+        {
+            if (empty())
+                throw std::out_of_range("unrolled_list is empty");
+            erase(iterator(tail, tail->count - 1));
+        }
+
+        void pop_front()
+        {
+            if (empty())
+                throw std::out_of_range("unrolled_list is empty");
+            erase(begin());
+        }
+
+        // Appends a run of elements, filling each node before opening the next.
+        template <class InputIt>
+        void append(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        }
+
+        template <class... Args>
+        iterator emplace(iterator pos, Args &&...args)
+        {
+            if (pos == end())
+            {
+                emplace_back(std::forward<Args>(args)...);
+                return iterator(tail, tail->count - 1);
+            }
+            Node *node = pos.node;
+            size_type at = pos.index;
+            if (node->count == NODE_CAPACITY)
+            {
+                if (at == 0 && node->prev && node->prev->count < NODE_CAPACITY)
+                {
+                    node = node->prev;
+                    at = node->count;
+                }
+                else
+                {
+                    Node *rest = split(node, NODE_CAPACITY / 2);
+                    if (at > node->count)
+                    {
+                        at -= node->count;
+                        node = rest;
+                    }
+                }
+            }
+            emplace_in_node(node, at, std::forward<Args>(args)...);
+            ++sz;
+            return iterator(node, at);
+        }
+
+        iterator insert(iterator pos, const value_type &val)
+        {
+            return emplace(pos, val);
+        }
+
+        iterator insert(iterator pos, value_type &&val)
+        {
+            return emplace(pos, std::move(val));
+        }
+
+        iterator erase(iterator pos)
+        {
+            Node *node = pos.node;
+            pointer e = node->elems();
+            std::move(e + pos.index + 1, e + node->count, e + pos.index);
+            alloc.destroy(e + node->count - 1);
+            --node->count;
+            --sz;
+            if (node->count == 0)
+            {
+                Node *next = node->next;
+                unlink_node(node);
+                return next ? iterator(next, 0) : end();
+            }
+            merge_next(node);
+            if (pos.index == node->count && node->next)
+                return iterator(node->next, 0);
+            return iterator(node, pos.index);
+        }
+
+        iterator erase(iterator first, iterator last)
+        {
+            if (last == end())
+            {
+                truncate(first.node, first.index);
+                return end();
+            }
+            difference_type n = std::distance(first, last);
+            while (n-- > 0)
+                first = erase(first);
+            return first;
+        }
+
+        void swap(unrolled_list &other)
+        {
+            std::swap(head, other.head);
+            std::swap(tail, other.tail);
+            std::swap(sz, other.sz);
+            std::swap(alloc, other.alloc);
+            std::swap(node_alloc, other.node_alloc);
+        }
+
+        // Moves all of other's nodes in before pos. Only the node holding pos
+        // is split, so the cost does not depend on other's size.
+        void splice(iterator pos, unrolled_list &other)
+        {
+            if (this == &other || other.empty())
+                return;
+            Node *before;
+            if (pos == end())
+                before = tail;
+            else if (pos.index == 0)
+                before = pos.node->prev;
+            else
+            {
+                split(pos.node, pos.index);
+                before = pos.node;
+            }
+            Node *after = before ? before->next : head;
+            other.head->prev = before;
+            other.tail->next = after;
+            if (before)
+                before->next = other.head;
+            else
+                head = other.head;
+            if (after)
+                after->prev = other.tail;
+            else
+                tail = other.tail;
+            sz += other.sz;
+            other.head = other.tail = nullptr;
+            other.sz = 0;
+        }
+
+        template <class Predicate>
+        void remove_if(Predicate pred)
+        {
+            erase(std::remove_if(begin(), end(), pred), end());
+        }
+
+        void remove(const value_type &val)
+        {
+            erase(std::remove(begin(), end(), val), end());
+        }
+
+        void unique()
+        {
+            erase(std::unique(begin(), end()), end());
+        }
+
+        template <class BinaryPredicate>
+        void unique(BinaryPredicate pred)
+        {
+            erase(std::unique(begin(), end(), pred), end());
+        }
+
+        void sort()
+        {
+            sort(std::less<value_type>());
+        }
+
+        // Stable; sorts a contiguous copy and moves the result back in place.
+        template <class Compare>
+        void sort(Compare comp)
+        {
+            if (sz < 2)
+                return;
+            ft::vector<value_type, allocator_type> tmp(alloc);
+            tmp.reserve(sz);
+            for (iterator it = begin(); it != end(); ++it)
+                tmp.push_back(std::move(*it));
+            std::stable_sort(tmp.begin(), tmp.end(), comp);
+            std::move(tmp.begin(), tmp.end(), begin());
+        }
+
+        void reverse()
+        {
+            if (sz < 2)
+                return;
+            std::reverse(begin(), end());
+        }
+
+        // Calls f(first, last) on each node's contiguous run of elements.
+        template <class Function>
+        Function for_each_segment(Function f)
+        {
+            for (Node *node = head; node; node = node->next)
+                f(node->elems(), node->elems() + node->count);
+            return f;
+        }
+
+        template <class Function>
+        Function for_each_segment(Function f) const
+        {
+            for (Node *node = head; node; node = node->next)
+                f(const_pointer(node->elems()), const_pointer(node->elems() + node->count));
+            return f;
+        }
+    };
+
+    template <typename T, class Alloc, std::size_t NodeBytes>
+    const typename unrolled_list<T, Alloc, NodeBytes>::size_type
+        unrolled_list<T, Alloc, NodeBytes>::NODE_CAPACITY;
+
+    template <typename T, class Alloc, std::size_t NodeBytes>
+    bool operator==(const unrolled_list<T, Alloc, NodeBytes> &lhs,
+                    const unrolled_list<T, Alloc, NodeBytes> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename T, class Alloc, std::size_t NodeBytes>
+    bool operator!=(const unrolled_list<T, Alloc, NodeBytes> &lhs,
+                    const unrolled_list<T, Alloc, NodeBytes> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename T, class Alloc, std::size_t NodeBytes>
+    bool operator<(const unrolled_list<T, Alloc, NodeBytes> &lhs,
+                   const unrolled_list<T, Alloc, NodeBytes> &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, class Alloc, std::size_t NodeBytes>
+    bool operator>(const unrolled_list<T, Alloc, NodeBytes> &lhs,
+                   const unrolled_list<T, Alloc, NodeBytes> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename T, class Alloc, std::size_t NodeBytes>
+    bool operator<=(const unrolled_list<T, Alloc, NodeBytes> &lhs,
+                    const unrolled_list<T, Alloc, NodeBytes> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename T, class Alloc, std::size_t NodeBytes>
+    bool operator>=(const unrolled_list<T, Alloc, NodeBytes> &lhs,
+                    const unrolled_list<T, Alloc, NodeBytes> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+}
@@ -5,11 +5,91 @@
 #include <stdexcept>
 #include <iterator>
 #include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#if defined(__GNUC__) && defined(__SSE2__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define FT_VECTOR_X86_SIMD 1
+#include <immintrin.h>
+#endif
 
 namespace ft
 {
 
-    template <typename T, class Alloc = std::allocator<T>>
+    // Types that may be moved to a new buffer with a plain memcpy. Specialize
+    // for types that are not trivially copyable but hold no self-references.
+    template <typename T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T>
+    {
+    };
+
+    // Growth policies pick the capacity ft::vector reallocates to once it is
+    // full. next_capacity may return less than needed; the vector clamps it.
+    struct grow_double
+    {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t,
+                                         std::size_t)
+        {
+            return capacity == 0 ? 1 : capacity * 2;
+        }
+    };
+
+    // Below the golden ratio, so after a few steps the blocks freed by earlier
+    // growth add up to the next request and the allocator can reuse them.
+    // Rounds up to malloc's 16-byte granularity so the slack is not wasted.
+    struct grow_one_and_half
+    {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t,
+                                         std::size_t elem_size)
+        {
+            std::size_t grown = capacity + capacity / 2 + 1;
+            std::size_t bytes = (grown * elem_size + 15) & ~std::size_t(15);
+            return bytes / elem_size;
+        }
+    };
+
+    struct grow_golden
+    {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t,
+                                         std::size_t)
+        {
+            return capacity + capacity * 5 / 8 + 1;
+        }
+    };
+
+    // Doubles while the buffer is smaller than a page, then grows by half and
+    // rounds to whole pages, which large allocations are served in anyway.
+    template <std::size_t PageSize = 4096>
+    struct grow_page_aligned
+    {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t needed,
+                                         std::size_t elem_size)
+        {
+            if ((capacity * 2) * elem_size < PageSize)
+                return capacity == 0 ? 1 : capacity * 2;
+            std::size_t grown = capacity + capacity / 2;
+            if (grown < needed)
+                grown = needed;
+            std::size_t pages = (grown * elem_size + PageSize - 1) / PageSize;
+            return pages * PageSize / elem_size;
+        }
+    };
+
+    template <std::size_t Increment>
+    struct grow_fixed
+    {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t,
+                                         std::size_t)
+        {
+            return capacity + Increment;
+        }
+    };
+
+    template <typename T, class Alloc = std::allocator<T>,
+              class Growth = grow_one_and_half>
     class vector
     {
     public:
@@ -223,6 +303,465 @@ namespace ft
         size_type _capacity;
         allocator_type _alloc;
 
+        typedef std::integral_constant<bool,
+                                       is_trivially_relocatable<T>::value>
+            _bitwise_relocatable;
+        typedef std::integral_constant<bool,
+                                       std::is_trivially_copyable<T>::value>
+            _bitwise_movable;
+
+        size_type _next_capacity(size_type min_capacity) const
+        {
+            if (min_capacity > max_size())
+                throw std::length_error("vector::reserve");
+            size_type grown = Growth::next_capacity(_capacity, min_capacity,
+                                                    sizeof(T));
+            if (grown < _capacity || grown > max_size())
+                grown = max_size();
+            return grown < min_capacity ? min_capacity : grown;
+        }
+
+        // Builds [dst, dst + n) from [src, src + n). Elements are moved when
+        // that cannot throw and copied otherwise, so a failure leaves src
+        // intact; the sources stay alive until _release_relocated.
+        void _relocate(pointer dst, pointer src, size_type n)
+        {
+            _relocate(dst, src, n, _bitwise_relocatable());
+        }
+
+        void _relocate(pointer dst, pointer src, size_type n, std::true_type)
+        {
+            if (n)
+                std::memcpy(static_cast<void *>(dst),
+                            static_cast<const void *>(src), n * sizeof(T));
+        }
+
+        void _relocate(pointer dst, pointer src, size_type n, std::false_type)
+        {
+            size_type i = 0;
+            try
+            {
+                for (; i < n; i++)
+                    _alloc.construct(dst + i, std::move_if_noexcept(src[i]));
+            }
+            catch (...)
+            {
+                while (i > 0)
+                    _alloc.destroy(dst + --i);
+                throw;
+            }
+        }
+
+        void _release_relocated(pointer p, size_type n)
+        {
+            _release_relocated(p, n, _bitwise_relocatable());
+        }
+
+        void _release_relocated(pointer, size_type, std::true_type) {}
+
+        void _release_relocated(pointer p, size_type n, std::false_type)
+        {
+            for (size_type i = 0; i < n; i++)
+                _alloc.destroy(p + i);
+        }
+
+        void _reallocate(size_type n)
+        {
+            pointer new_data = _alloc.allocate(n);
+            try
+            {
+                _relocate(new_data, _data, _size);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(new_data, n);
+                throw;
+            }
+            _release_relocated(_data, _size);
+            if (_data)
+                _alloc.deallocate(_data, _capacity);
+            _data = new_data;
+            _capacity = n;
+        }
+
+        void _destroy(pointer p, size_type n)
+        {
+            for (size_type i = 0; i < n; i++)
+                _alloc.destroy(p + i);
+        }
+
+        // Builds n copies of val at p. Trivially copyable values go through
+        // memset when they are a single byte or all-zero, else a plain store
+        // loop the compiler can vectorize.
+        void _fill_construct(pointer p, size_type n, const value_type &val)
+        {
+            _fill_construct(p, n, val, _bitwise_movable());
+        }
+
+        void _fill_construct(pointer p, size_type n, const value_type &val,
+                             std::true_type)
+        {
+            const unsigned char *bytes =
+                reinterpret_cast<const unsigned char *>(&val);
+            if (sizeof(T) == 1)
+                std::memset(static_cast<void *>(p), bytes[0], n);
+            else if (_all_zero(bytes))
+                std::memset(static_cast<void *>(p), 0, n * sizeof(T));
+            else
+                std::fill_n(p, n, val);
+        }
+
+        void _fill_construct(pointer p, size_type n, const value_type &val,
+                             std::false_type)
+        {
+            size_type i = 0;
+            try
+            {
+                for (; i < n; i++)
+                    _alloc.construct(p + i, val);
+            }
+            catch (...)
+            {
+                _destroy(p, i);
+                throw;
+            }
+        }
+
+        static bool _all_zero(const unsigned char *bytes)
+        {
+            for (std::size_t i = 0; i < sizeof(T); i++)
+                if (bytes[i])
+                    return false;
+            return true;
+        }
+
+        // Default-initializes n elements at p: trivial types keep whatever
+        // bytes the buffer held, others are value-constructed as usual.
+        void _default_construct(pointer, size_type, std::true_type) {}
+
+        void _default_construct(pointer p, size_type n, std::false_type)
+        {
+            size_type i = 0;
+            try
+            {
+                for (; i < n; i++)
+                    _alloc.construct(p + i);
+            }
+            catch (...)
+            {
+                _destroy(p, i);
+                throw;
+            }
+        }
+
+        template <class InputIt>
+        pointer _uninitialized_copy(InputIt first, InputIt last, pointer dst)
+        {
+            pointer cur = dst;
+            try
+            {
+                for (; first != last; ++first, ++cur)
+                    _alloc.construct(cur, *first);
+            }
+            catch (...)
+            {
+                _destroy(dst, cur - dst);
+                throw;
+            }
+            return cur;
+        }
+
+        pointer _uninitialized_move(pointer first, pointer last, pointer dst)
+        {
+            return _uninitialized_copy(std::make_move_iterator(first),
+                                       std::make_move_iterator(last), dst);
+        }
+
+        // Trivially copyable tails are shifted with one memmove; the gap it
+        // leaves is overwritten by the caller. Only valid when
+        // _bitwise_movable holds and capacity has room for n more.
+        void _shift_tail(size_type pos, size_type n)
+        {
+            if (_size > pos)
+                std::memmove(static_cast<void *>(_data + pos + n),
+                             static_cast<const void *>(_data + pos),
+                             (_size - pos) * sizeof(T));
+            _size += n;
+        }
+
+        // Moves [pos, end) one slot back, leaving a live element at pos.
+        void _shift_back_one(size_type pos, std::true_type)
+        {
+            _shift_tail(pos, 1);
+        }
+
+        void _shift_back_one(size_type pos, std::false_type)
+        {
+            _alloc.construct(_data + _size, std::move(_data[_size - 1]));
+            ++_size;
+            std::move_backward(_data + pos, _data + _size - 2,
+                               _data + _size - 1);
+        }
+
+        void _move_down(pointer first, pointer last, pointer dst,
+                        std::true_type)
+        {
+            if (first != last)
+                std::memmove(static_cast<void *>(dst),
+                             static_cast<const void *>(first),
+                             (last - first) * sizeof(T));
+        }
+
+        void _move_down(pointer first, pointer last, pointer dst,
+                        std::false_type)
+        {
+            std::move(first, last, dst);
+        }
+
+        // Relocates the current elements into new_data around the n elements
+        // already built at pos, then adopts new_data. On failure the gap is
+        // destroyed, new_data released and *this left untouched.
+        void _adopt_around_gap(pointer new_data, size_type new_capacity,
+                               size_type pos, size_type n)
+        {
+            try
+            {
+                _relocate(new_data, _data, pos);
+                try
+                {
+                    _relocate(new_data + pos + n, _data + pos, _size - pos);
+                }
+                catch (...)
+                {
+                    _destroy(new_data, pos);
+                    throw;
+                }
+            }
+            catch (...)
+            {
+                _destroy(new_data + pos, n);
+                _alloc.deallocate(new_data, new_capacity);
+                throw;
+            }
+            _release_relocated(_data, _size);
+            if (_data)
+                _alloc.deallocate(_data, _capacity);
+            _data = new_data;
+            _capacity = new_capacity;
+            _size += n;
+        }
+
+        // Grows into a fresh buffer, building the new element at pos before
+        // anything moves so that arguments referring into *this stay valid.
+        template <class... Args>
+        void _realloc_emplace(size_type pos, Args &&...args)
+        {
+            size_type new_capacity = _next_capacity(_size + 1);
+            pointer new_data = _alloc.allocate(new_capacity);
+            try
+            {
+                _alloc.construct(new_data + pos, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(new_data, new_capacity);
+                throw;
+            }
+            _adopt_around_gap(new_data, new_capacity, pos, 1);
+        }
+
+        template <class InputIt>
+        void _range_insert(size_type pos, InputIt first, InputIt last,
+                           std::input_iterator_tag)
+        {
+            vector tmp(first, last);
+            _range_insert(pos, std::make_move_iterator(tmp.begin()),
+                          std::make_move_iterator(tmp.end()),
+                          std::forward_iterator_tag());
+        }
+
+        template <class ForwardIt>
+        void _range_insert(size_type pos, ForwardIt first, ForwardIt last,
+                           std::forward_iterator_tag)
+        {
+            size_type n = std::distance(first, last);
+            if (n == 0)
+                return;
+            if (_size + n > _capacity)
+            {
+                size_type new_capacity = _next_capacity(_size + n);
+                pointer new_data = _alloc.allocate(new_capacity);
+                try
+                {
+                    _uninitialized_copy(first, last, new_data + pos);
+                }
+                catch (...)
+                {
+                    _alloc.deallocate(new_data, new_capacity);
+                    throw;
+                }
+                _adopt_around_gap(new_data, new_capacity, pos, n);
+                return;
+            }
+            _insert_in_place(pos, first, last, n, _bitwise_movable());
+        }
+
+        template <class ForwardIt>
+        void _insert_in_place(size_type pos, ForwardIt first, ForwardIt last,
+                              size_type n, std::true_type)
+        {
+            _shift_tail(pos, n);
+            std::copy(first, last, _data + pos);
+        }
+
+        template <class ForwardIt>
+        void _insert_in_place(size_type pos, ForwardIt first, ForwardIt last,
+                              size_type n, std::false_type)
+        {
+            size_type elems_after = _size - pos;
+            pointer old_end = _data + _size;
+            if (elems_after > n)
+            {
+                _uninitialized_move(old_end - n, old_end, old_end);
+                _size += n;
+                std::move_backward(_data + pos, old_end - n, old_end);
+                std::copy(first, last, _data + pos);
+            }
+            else
+            {
+                ForwardIt mid = first;
+                std::advance(mid, elems_after);
+                _uninitialized_copy(mid, last, old_end);
+                _size += n - elems_after;
+                _uninitialized_move(_data + pos, old_end, _data + pos + n);
+                _size += elems_after;
+                std::copy(first, mid, _data + pos);
+            }
+        }
+
+        void _fill_insert(size_type pos, size_type n, const value_type &val)
+        {
+            if (n == 0)
+                return;
+            if (_size + n > _capacity)
+            {
+                size_type new_capacity = _next_capacity(_size + n);
+                pointer new_data = _alloc.allocate(new_capacity);
+                try
+                {
+                    _fill_construct(new_data + pos, n, val);
+                }
+                catch (...)
+                {
+                    _alloc.deallocate(new_data, new_capacity);
+                    throw;
+                }
+                _adopt_around_gap(new_data, new_capacity, pos, n);
+                return;
+            }
+            value_type tmp(val);
+            _fill_in_place(pos, n, tmp, _bitwise_movable());
+        }
+
+        void _fill_in_place(size_type pos, size_type n, const value_type &val,
+                            std::true_type)
+        {
+            _shift_tail(pos, n);
+            _fill_construct(_data + pos, n, val);
+        }
+
+        void _fill_in_place(size_type pos, size_type n, const value_type &val,
+                            std::false_type)
+        {
+            size_type elems_after = _size - pos;
+            pointer old_end = _data + _size;
+            if (elems_after > n)
+            {
+                _uninitialized_move(old_end - n, old_end, old_end);
+                _size += n;
+                std::move_backward(_data + pos, old_end - n, old_end);
+                std::fill_n(_data + pos, n, val);
+            }
+            else
+            {
+                _fill_construct(old_end, n - elems_after, val);
+                _size += n - elems_after;
+                _uninitialized_move(_data + pos, old_end, _data + pos + n);
+                _size += elems_after;
+                std::fill(_data + pos, old_end, val);
+            }
+        }
+
+        template <class InputIt>
+        void _range_assign(InputIt first, InputIt last, std::input_iterator_tag)
+        {
+            clear();
+            for (; first != last; ++first)
+                emplace_back(*first);
+        }
+
+        template <class ForwardIt>
+        void _range_assign(ForwardIt first, ForwardIt last,
+                           std::forward_iterator_tag)
+        {
+            size_type n = std::distance(first, last);
+            if (n > _capacity)
+            {
+                pointer new_data = _alloc.allocate(n);
+                try
+                {
+                    _uninitialized_copy(first, last, new_data);
+                }
+                catch (...)
+                {
+                    _alloc.deallocate(new_data, n);
+                    throw;
+                }
+                clear();
+                if (_data)
+                    _alloc.deallocate(_data, _capacity);
+                _data = new_data;
+                _capacity = n;
+            }
+            else if (n <= _size)
+            {
+                pointer new_end = std::copy(first, last, _data);
+                _destroy(new_end, _size - n);
+            }
+            else
+            {
+                ForwardIt mid = first;
+                std::advance(mid, _size);
+                std::copy(first, mid, _data);
+                _uninitialized_copy(mid, last, _data + _size);
+            }
+            _size = n;
+        }
+
+    protected:
+        // Frees the current buffer and takes over other's, leaving other
+        // empty. Allocators are left alone, so both must be able to release
+        // each other's memory.
+        void _steal_buffer(vector &other)
+        {
+            clear();
+            if (_data)
+                _alloc.deallocate(_data, _capacity);
+            _data = other._data;
+            _size = other._size;
+            _capacity = other._capacity;
+            other._data = NULL;
+            other._size = 0;
+            other._capacity = 0;
+        }
+
+        // Moves the elements into a fresh buffer of exactly n slots, so a
+        // derived container can steer them back into storage it owns.
+        void _rebuffer(size_type n)
+        {
+            _reallocate(n);
+        }
+
     public:
         explicit vector(const allocator_type &alloc = allocator_type())
             : _data(NULL), _size(0), _capacity(0), _alloc(alloc) {}
@@ -232,12 +771,28 @@ namespace ft
             : _data(NULL), _size(0), _capacity(0), _alloc(alloc)
         {
             _data = _alloc.allocate(n);
-            for (size_type i = 0; i < n; i++)
-                _alloc.construct(&_data[i], val);
+            try
+            {
+                _fill_construct(_data, n, val);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(_data, n);
+                throw;
+            }
             _size = n;
             _capacity = n;
         }
 
+        template <class InputIt>
+        vector(InputIt first, InputIt last,
+               const allocator_type &alloc = allocator_type(),
+               typename std::enable_if<!std::is_integral<InputIt>::value>::type * = 0)
+            : _data(NULL), _size(0), _capacity(0), _alloc(alloc)
+        {
+            assign(first, last);
+        }
+
         vector(const vector &other)
             : _data(NULL), _size(0), _capacity(0), _alloc(other._alloc)
         {
@@ -247,6 +802,25 @@ namespace ft
             _size = other._size;
         }
 
+        vector(vector &&other) noexcept
+            : _data(other._data), _size(other._size),
+              _capacity(other._capacity), _alloc(other._alloc)
+        {
+            other._data = NULL;
+            other._size = 0;
+            other._capacity = 0;
+        }
+
+        vector &operator=(vector &&other) noexcept
+        {
+            if (this != &other)
+            {
+                _steal_buffer(other);
+                _alloc = other._alloc;
+            }
+            return *this;
+        }
+
         vector &operator=(const vector &other)
         {
             if (this != &other)
@@ -321,40 +895,51 @@ namespace ft
         {
             return _alloc.max_size();
         }
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
         void resize(size_t new_size, const T &value = T())
         {
             if (new_size < _size)
             {
-                for (size_t i = new_size; i < _size; ++i)
-                    _alloc.destroy(_data + i);
+                _destroy(_data + new_size, _size - new_size);
                 _size = new_size;
             }
             else if (new_size > _size)
             {
                 if (new_size > _capacity)
+                {
+                    value_type tmp(value);
                     reserve(new_size);
-                for (size_t i = _size; i < new_size; ++i)
-                    _alloc.construct(_data + i, value);
-
+                    _fill_construct(_data + _size, new_size - _size, tmp);
+                }
+                else
+                    _fill_construct(_data + _size, new_size - _size, value);
                 _size = new_size;
             }
         }
 
-        void shrink_to_fit()
+        // Like resize, but new elements are default-initialized: for trivial
+        // types the storage is left as is, ready to be overwritten by I/O.
+        void resize_uninitialized(size_t new_size)
         {
-            if (_size < _capacity)
+            if (new_size < _size)
+                _destroy(_data + new_size, _size - new_size);
+            else if (new_size > _size)
             {
-                T *new_data = _alloc.allocate(_size);
-                for (size_t i = 0; i < _size; ++i)
-                {
-                    _alloc.construct(new_data + i, _data[i]);
-                    _alloc.destroy(_data + i);
-                }
-                if (_data)
-                    _alloc.deallocate(_data, _capacity);
-                _data = new_data;
-                _capacity = _size;
+                if (new_size > _capacity)
+                    reserve(new_size);
+                _default_construct(_data + _size, new_size - _size,
+                                   std::is_trivially_default_constructible<T>());
             }
+            _size = new_size;
+        }
+
+        void shrink_to_fit()
+        {
+            if (_size < _capacity)
+                _reallocate(_size);
         }
 
         bool empty() const
@@ -405,32 +990,65 @@ namespace ft
             return _data[_size - 1];
         }
 
-        reference data()
+        pointer data()
         {
             return _data;
         }
 
-        const_reference data() const
+        const_pointer data() const
         {
             return _data;
         }
 
         void assign(size_type n, const value_type &val)
         {
-            clear();
             if (n > _capacity)
-                reserve(n);
-            for (size_type i = 0; i < n; i++)
-                _alloc.construct(&_data[i], val);
+            {
+                pointer new_data = _alloc.allocate(n);
+                try
+                {
+                    _fill_construct(new_data, n, val);
+                }
+                catch (...)
+                {
+                    _alloc.deallocate(new_data, n);
+                    throw;
+                }
+                clear();
+                if (_data)
+                    _alloc.deallocate(_data, _capacity);
+                _data = new_data;
+                _capacity = n;
+            }
+            else if (n <= _size)
+            {
+                std::fill_n(_data, n, val);
+                _destroy(_data + n, _size - n);
+            }
+            else
+            {
+                std::fill(_data, _data + _size, val);
+                _fill_construct(_data + _size, n - _size, val);
+            }
             _size = n;
         }
 
+        template <class InputIt>
+        typename std::enable_if<!std::is_integral<InputIt>::value>::type
+        assign(InputIt first, InputIt last)
+        {
+            _range_assign(first, last,
+                          typename std::iterator_traits<InputIt>::iterator_category());
+        }
+
         void push_back(const value_type &val)
         {
-            if (_size == _capacity)
-                reserve(_capacity == 0 ? 1 : _capacity * 2);
-            _alloc.construct(&_data[_size], val);
-            ++_size;
+            emplace_back(val);
+        }
+
+        void push_back(value_type &&val)
+        {
+            emplace_back(std::move(val));
         }
 
         void pop_back()
@@ -442,42 +1060,48 @@ namespace ft
             }
         }
 
-        void insert(iterator position, const value_type &val)
+        iterator insert(iterator position, const value_type &val)
         {
-            size_type pos_index = position - begin();
-            if (_size == _capacity)
-                reserve(_capacity == 0 ? 1 : _capacity * 2);
-            for (size_type i = _size; i > pos_index; i--)
-                _alloc.construct(&_data[i], _data[i - 1]);
-            _alloc.construct(&_data[pos_index], val);
-            ++_size;
+            return emplace(position, val);
+        }
+
+        iterator insert(iterator position, value_type &&val)
+        {
+            return emplace(position, std::move(val));
         }
 
         void insert(iterator position, size_type n, const value_type &val)
         {
-            size_type pos_index = position - begin();
-            if (_size + n > _capacity)
-                reserve(_size + n > _capacity * 2 ? _size + n : _capacity * 2);
-            for (size_type i = _size + n - 1; i >= pos_index + n; i--)
-                _alloc.construct(&_data[i], _data[i - n]);
-            for (size_type i = 0; i < n; i++)
-                _alloc.construct(&_data[pos_index + i], val);
-            _size += n;
+            _fill_insert(position - begin(), n, val);
         }
 
-        void erase(iterator position)
+        template <class InputIt>
+        typename std::enable_if<!std::is_integral<InputIt>::value, iterator>::type
+        insert(iterator position, InputIt first, InputIt last)
         {
             size_type pos_index = position - begin();
-            if (pos_index < _size)
+            _range_insert(pos_index, first, last,
+                          typename std::iterator_traits<InputIt>::iterator_category());
+            return iterator(_data + pos_index);
+        }
+
+        iterator erase(iterator position)
+        {
+            return erase(position, position + 1);
+        }
+
+        iterator erase(iterator first, iterator last)
+        {
+            size_type pos_index = first - begin();
+            size_type n = last - first;
+            if (n)
             {
-                _alloc.destroy(&_data[pos_index]);
-                for (size_type i = pos_index; i < _size - 1; i++)
-                {
-                    _alloc.construct(&_data[i], _data[i + 1]);
-                    _alloc.destroy(&_data[i + 1]);
-                }
-                --_size;
+                _move_down(_data + pos_index + n, _data + _size,
+                           _data + pos_index, _bitwise_movable());
+                _destroy(_data + _size - n, n);
+                _size -= n;
             }
+            return iterator(_data + pos_index);
         }
 
         void swap(vector &other)
@@ -498,36 +1122,131 @@ namespace ft
         void reserve(size_type n)
         {
             if (n > _capacity)
+                _reallocate(n);
+        }
+
+        template <class... Args>
+        iterator emplace(iterator position, Args &&...args)
+        {
+            size_type pos_index = position - begin();
+            if (_size == _capacity)
+                _realloc_emplace(pos_index, std::forward<Args>(args)...);
+            else if (pos_index == _size)
             {
-                pointer new_data = _alloc.allocate(n);
-                for (size_type i = 0; i < _size; i++)
-                    _alloc.construct(&new_data[i], _data[i]);
-                for (size_type i = 0; i < _size; i++)
-                    _alloc.destroy(&_data[i]);
-                if (_data)
-                    _alloc.deallocate(_data, _capacity);
-                _data = new_data;
-                _capacity = n;
+                _alloc.construct(_data + _size, std::forward<Args>(args)...);
+                ++_size;
+            }
+            else
+            {
+                value_type tmp(std::forward<Args>(args)...);
+                _shift_back_one(pos_index, _bitwise_movable());
+                _data[pos_index] = std::move(tmp);
             }
+            return iterator(_data + pos_index);
         }
 
-        void emplace(iterator position, const value_type &val)
+        template <class... Args>
+        void emplace_back(Args &&...args)
         {
-            insert(position, val);
+            if (_size == _capacity)
+                _realloc_emplace(_size, std::forward<Args>(args)...);
+            else
+            {
+                _alloc.construct(_data + _size, std::forward<Args>(args)...);
+                ++_size;
+            }
         }
+    };
+
+    // Element types whose == and < agree with their object representation
+    // byte for byte, so equality is a memcmp and the first differing element
+    // can be found by a byte scan.
+    template <typename T>
+    struct _bytewise_comparable
+        : std::integral_constant<bool, std::is_integral<T>::value ||
+                                           std::is_pointer<T>::value>
+    {
+    };
+
+    inline std::size_t _mismatch_bytes_scalar(const unsigned char *a,
+                                              const unsigned char *b,
+                                              std::size_t i, std::size_t n)
+    {
+        for (; i < n; ++i)
+            if (a[i] != b[i])
+                return i;
+        return n;
+    }
 
-        void emplace_back(const value_type &val)
+#ifdef FT_VECTOR_X86_SIMD
+    inline std::size_t _mismatch_bytes_sse2(const unsigned char *a,
+                                            const unsigned char *b,
+                                            std::size_t i, std::size_t n)
+    {
+        for (; i + 16 <= n; i += 16)
         {
-            push_back(val);
+            __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+            __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+            unsigned mask = ~static_cast<unsigned>(
+                                _mm_movemask_epi8(_mm_cmpeq_epi8(va, vb))) &
+                            0xFFFFu;
+            if (mask)
+                return i + __builtin_ctz(mask);
         }
-    };
+        return _mismatch_bytes_scalar(a, b, i, n);
+    }
 
-    template <typename T, class Alloc>
-    bool operator==(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    __attribute__((target("avx2"))) inline std::size_t
+    _mismatch_bytes_avx2(const unsigned char *a, const unsigned char *b,
+                         std::size_t i, std::size_t n)
     {
-        if (lhs.size() != rhs.size())
-            return false;
-        for (size_t i = 0; i < lhs.size(); i++)
+        for (; i + 32 <= n; i += 32)
+        {
+            __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+            __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+            unsigned mask = ~static_cast<unsigned>(
+                _mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+            if (mask)
+                return i + __builtin_ctz(mask);
+        }
+        return _mismatch_bytes_sse2(a, b, i, n);
+    }
+
+    inline bool _cpu_has_avx2()
+    {
+        static const bool avx2 = (__builtin_cpu_init(),
+                                  __builtin_cpu_supports("avx2") != 0);
+        return avx2;
+    }
+#endif
+
+    // Offset of the first byte that differs between a and b, or n.
+    inline std::size_t _mismatch_bytes(const void *a, const void *b,
+                                       std::size_t n)
+    {
+        const unsigned char *pa = static_cast<const unsigned char *>(a);
+        const unsigned char *pb = static_cast<const unsigned char *>(b);
+#ifdef FT_VECTOR_X86_SIMD
+        if (_cpu_has_avx2())
+            return _mismatch_bytes_avx2(pa, pb, 0, n);
+        return _mismatch_bytes_sse2(pa, pb, 0, n);
+#else
+        return _mismatch_bytes_scalar(pa, pb, 0, n);
+#endif
+    }
+
+    template <typename T>
+    bool _vector_equal(const T *lhs, const T *rhs, std::size_t n,
+                       std::true_type)
+    {
+        return n == 0 || std::memcmp(lhs, rhs, n * sizeof(T)) == 0;
+    }
+
+    template <typename T>
+    bool _vector_equal(const T *lhs, const T *rhs, std::size_t n,
+                       std::false_type)
+    {
+        for (std::size_t i = 0; i < n; i++)
         {
             if (lhs[i] != rhs[i])
                 return false;
@@ -535,40 +1254,66 @@ namespace ft
         return true;
     }
 
-    template <typename T, class Alloc>
-    bool operator!=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    // Index of the first position where lhs and rhs are not equivalent.
+    template <typename T>
+    std::size_t _vector_mismatch(const T *lhs, const T *rhs, std::size_t n,
+                                 std::true_type)
+    {
+        if (n == 0)
+            return 0;
+        return _mismatch_bytes(lhs, rhs, n * sizeof(T)) / sizeof(T);
+    }
+
+    template <typename T>
+    std::size_t _vector_mismatch(const T *lhs, const T *rhs, std::size_t n,
+                                 std::false_type)
+    {
+        std::size_t i = 0;
+        while (i < n && !(lhs[i] < rhs[i]) && !(rhs[i] < lhs[i]))
+            ++i;
+        return i;
+    }
+
+    template <typename T, class Alloc, class Growth>
+    bool operator==(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        return _vector_equal(lhs.data(), rhs.data(), lhs.size(),
+                             _bytewise_comparable<T>());
+    }
+
+    template <typename T, class Alloc, class Growth>
+    bool operator!=(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
     {
         return !(lhs == rhs);
     }
 
-    template <typename T, class Alloc>
-    bool operator<(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template <typename T, class Alloc, class Growth>
+    bool operator<(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
     {
         size_t n = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
-        for (size_t i = 0; i < n; i++)
-        {
-            if (lhs[i] < rhs[i])
-                return true;
-            if (rhs[i] < lhs[i])
-                return false;
-        }
+        size_t i = _vector_mismatch(lhs.data(), rhs.data(), n,
+                                    _bytewise_comparable<T>());
+        if (i < n)
+            return lhs[i] < rhs[i];
         return lhs.size() < rhs.size();
     }
 
-    template <typename T, class Alloc>
-    bool operator<=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template <typename T, class Alloc, class Growth>
+    bool operator<=(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
     {
         return !(rhs < lhs);
     }
 
-    template <typename T, class Alloc>
-    bool operator>(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template <typename T, class Alloc, class Growth>
+    bool operator>(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
     {
         return rhs < lhs;
     }
 
-    template <typename T, class Alloc>
-    bool operator>=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template <typename T, class Alloc, class Growth>
+    bool operator>=(const vector<T, Alloc, Growth> &lhs, const vector<T, Alloc, Growth> &rhs)
     {
         return !(lhs < rhs);
     }